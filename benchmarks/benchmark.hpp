@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_BENCHMARK_HPP
+#define CRYPTO3_ZK_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace benchmark {
+
+                /**
+                 * Comma separated list of sizes taken from the environment variable, e.g.
+                 * ZK_BENCHMARK_LOG_SIZES=10,14,18. Falls back to defaults if the variable is not set.
+                 */
+                inline std::vector<std::size_t> parameters(const char *variable,
+                                                           const std::vector<std::size_t> &defaults) {
+                    const char *value = std::getenv(variable);
+                    if (value == nullptr) {
+                        return defaults;
+                    }
+
+                    std::vector<std::size_t> result;
+                    std::stringstream stream(value);
+                    std::string item;
+                    while (std::getline(stream, item, ',')) {
+                        if (!item.empty()) {
+                            result.push_back(std::stoul(item));
+                        }
+                    }
+                    return result.empty() ? defaults : result;
+                }
+
+                inline std::vector<std::size_t> log_sizes(const std::vector<std::size_t> &defaults) {
+                    return parameters("ZK_BENCHMARK_LOG_SIZES", defaults);
+                }
+
+                inline std::vector<std::size_t> batch_sizes(const std::vector<std::size_t> &defaults) {
+                    return parameters("ZK_BENCHMARK_BATCH_SIZES", defaults);
+                }
+
+                /// Each measurement repeats the operation until it took at least that many seconds
+                inline double min_time() {
+                    const char *value = std::getenv("ZK_BENCHMARK_MIN_TIME");
+                    return value == nullptr ? 1.0 : std::stod(value);
+                }
+
+                struct measurement_type {
+                    std::string name;
+                    std::string field;
+                    std::size_t domain_size;
+                    std::size_t batch_size;
+                    std::size_t iterations;
+                    double seconds;
+
+                    double operations_per_second() const {
+                        return iterations / seconds;
+                    }
+
+                    /// Elements of the domain processed per second over the whole batch
+                    double elements_per_second() const {
+                        return static_cast<double>(domain_size) * batch_size * iterations / seconds;
+                    }
+                };
+
+                inline void report(const measurement_type &measurement, std::ostream &os = std::cout) {
+                    static bool header_written = false;
+                    if (!header_written) {
+                        os << "benchmark,field,domain_size,batch_size,iterations,ms_per_operation,operations_per_s,"
+                              "elements_per_s"
+                           << std::endl;
+                        header_written = true;
+                    }
+                    os << measurement.name << "," << measurement.field << "," << measurement.domain_size << ","
+                       << measurement.batch_size << "," << measurement.iterations << ","
+                       << measurement.seconds * 1000 / measurement.iterations << ","
+                       << measurement.operations_per_second() << "," << measurement.elements_per_second()
+                       << std::endl;
+                }
+
+                /**
+                 * Runs operation at least once and until min_time() seconds passed, then reports the throughput.
+                 * domain_size and batch_size only label the measurement and scale the elements throughput.
+                 */
+                template<typename Operation>
+                measurement_type run(const std::string &name, const std::string &field, std::size_t domain_size,
+                                     std::size_t batch_size, Operation &&operation) {
+                    using clock_type = std::chrono::steady_clock;
+
+                    const double time_limit = min_time();
+                    std::size_t iterations = 0;
+                    double seconds = 0;
+                    const clock_type::time_point start = clock_type::now();
+                    do {
+                        operation();
+                        iterations++;
+                        seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+                    } while (seconds < time_limit);
+
+                    measurement_type measurement {name, field, domain_size, batch_size, iterations, seconds};
+                    report(measurement);
+                    return measurement;
+                }
+            }    // namespace benchmark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_BENCHMARK_HPP
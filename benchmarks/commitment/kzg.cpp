@@ -0,0 +1,128 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE kzg_benchmark
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/mnt4.hpp>
+#include <nil/crypto3/algebra/pairing/mnt4.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/kzg_ipp2.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/ipp2/srs.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/ipp2/prover.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+struct bls12_381_setup {
+    typedef algebra::curves::bls12<381> curve_type;
+    constexpr static const char *name = "bls12_381";
+};
+
+struct mnt4_298_setup {
+    typedef algebra::curves::mnt4<298> curve_type;
+    constexpr static const char *name = "mnt4_298";
+};
+
+typedef boost::mpl::list<bls12_381_setup, mnt4_298_setup> setups;
+
+BOOST_AUTO_TEST_SUITE(kzg_benchmark_suite)
+
+// KZG as used by the IPP2 aggregation: commitments are multiexponentiations over the structured powers
+// of the SRS, openings are produced by prove_commitment_key_kzg_opening()
+BOOST_AUTO_TEST_CASE_TEMPLATE(kzg_benchmark, SetupType, setups) {
+    typedef typename SetupType::curve_type curve_type;
+    typedef typename curve_type::scalar_field_type scalar_field_type;
+    typedef typename scalar_field_type::value_type scalar_value_type;
+    typedef typename curve_type::template g1_type<> g1_type;
+    typedef typename curve_type::template g2_type<> g2_type;
+    typedef typename g1_type::value_type g1_value_type;
+
+    const scalar_value_type alpha = algebra::random_element<scalar_field_type>();
+    const scalar_value_type beta = algebra::random_element<scalar_field_type>();
+    const scalar_value_type z = algebra::random_element<scalar_field_type>();
+
+    for (std::size_t log_size : zk::benchmark::log_sizes({8, 10, 12})) {
+        const std::size_t d = std::size_t(1) << log_size;
+
+        const std::vector<g1_value_type> g_alpha_powers =
+            zk::snark::structured_generators_scalar_power<g1_type>(d, alpha);
+        const std::vector<g1_value_type> g_beta_powers =
+            zk::snark::structured_generators_scalar_power<g1_type>(d, beta);
+
+        for (std::size_t batch_size : zk::benchmark::batch_sizes({1, 4})) {
+            std::vector<math::polynomial<scalar_value_type>> f(batch_size, math::polynomial<scalar_value_type>(d));
+            std::vector<scalar_value_type> y(batch_size);
+            for (std::size_t i = 0; i < batch_size; i++) {
+                for (auto &coefficient : f[i]) {
+                    coefficient = algebra::random_element<scalar_field_type>();
+                }
+                y[i] = f[i].evaluate(z);
+            }
+
+            std::vector<g1_value_type> commitments(batch_size);
+            zk::benchmark::run("kzg_commit", SetupType::name, d, batch_size, [&]() {
+                for (std::size_t i = 0; i < batch_size; i++) {
+                    commitments[i] = algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(
+                        g_alpha_powers.begin(), g_alpha_powers.end(), f[i].begin(), f[i].end(), 1);
+                }
+            });
+
+            std::vector<typename zk::commitments::kzg_ipp2<curve_type>::template opening_type<g1_type>> openings(
+                batch_size);
+            zk::benchmark::run("kzg_open", SetupType::name, d, batch_size, [&]() {
+                for (std::size_t i = 0; i < batch_size; i++) {
+                    openings[i] = zk::snark::prove_commitment_key_kzg_opening<g1_type>(
+                        g_alpha_powers.begin(), g_alpha_powers.end(), g_beta_powers.begin(), g_beta_powers.end(),
+                        f[i], y[i], z);
+                }
+            });
+
+            // e(C - y * g, h) = e(pi, (alpha - z) * h)
+            BOOST_CHECK(algebra::pair_reduced<curve_type>(commitments[0] - g1_value_type::one() * y[0],
+                                                          g2_type::value_type::one()) ==
+                        algebra::pair_reduced<curve_type>(openings[0].first,
+                                                          g2_type::value_type::one() * (alpha - z)));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,135 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE lpc_benchmark
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/fri.hpp>
+#include <nil/crypto3/zk/commitments/polynomial/lpc.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+struct pallas_setup {
+    typedef algebra::curves::pallas::base_field_type field_type;
+    constexpr static const char *name = "pallas_base";
+};
+
+struct bls12_381_setup {
+    typedef algebra::curves::bls12<381>::scalar_field_type field_type;
+    constexpr static const char *name = "bls12_381_scalar";
+};
+
+typedef boost::mpl::list<pallas_setup, bls12_381_setup> setups;
+
+BOOST_AUTO_TEST_SUITE(lpc_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batched_lpc_benchmark, SetupType, setups) {
+    typedef typename SetupType::field_type FieldType;
+
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+
+    typedef typename containers::merkle_tree<merkle_hash_type, 2> merkle_tree_type;
+
+    constexpr static const std::size_t lambda = 40;
+    constexpr static const std::size_t r = 1;
+    constexpr static const std::size_t m = 2;
+    // log2 of the FRI blowup factor
+    constexpr static const std::size_t expand_factor = 2;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m, 0, false> fri_type;
+    typedef zk::commitments::list_polynomial_commitment_params<merkle_hash_type, transcript_hash_type, lambda, r, m, 0,
+                                                               false>
+        lpc_params_type;
+    typedef zk::commitments::batched_list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+    nil::crypto3::random::algebraic_random_device<FieldType> rnd;
+    const std::array<std::uint8_t, 96> x_data {};
+
+    for (std::size_t log_size : zk::benchmark::log_sizes({10, 12, 14})) {
+        const std::size_t d = std::size_t(1) << log_size;
+
+        typename fri_type::params_type fri_params;
+        fri_params.r = log_size - 1;
+        fri_params.D = math::calculate_domain_set<FieldType>(log_size + expand_factor, fri_params.r);
+        fri_params.max_degree = d - 1;
+        fri_params.step_list = std::vector<std::size_t>(fri_params.r, 1);
+
+        for (std::size_t batch_size : zk::benchmark::batch_sizes({1, 4, 16})) {
+            std::vector<math::polynomial_dfs<typename FieldType::value_type>> f(batch_size);
+            for (auto &f_i : f) {
+                math::polynomial<typename FieldType::value_type> coefficients(d);
+                std::generate(std::begin(coefficients), std::end(coefficients), [&rnd]() { return rnd(); });
+                f_i.from_coefficients(coefficients);
+            }
+
+            std::vector<std::vector<typename FieldType::value_type>> evaluation_points(
+                batch_size, {algebra::fields::arithmetic_params<FieldType>::multiplicative_generator});
+
+            merkle_tree_type tree;
+            zk::benchmark::run("batched_lpc_precommit", SetupType::name, d, batch_size, [&]() {
+                tree = zk::algorithms::precommit<lpc_type>(f, fri_params.D[0], fri_params.step_list.front());
+            });
+
+            typename lpc_type::proof_type proof;
+            zk::benchmark::run("batched_lpc_prove", SetupType::name, d, batch_size, [&]() {
+                zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+                proof = zk::algorithms::proof_eval<lpc_type>(evaluation_points, tree, f, fri_params, transcript);
+            });
+
+            bool verified = false;
+            zk::benchmark::run("batched_lpc_verify", SetupType::name, d, batch_size, [&]() {
+                zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+                verified = zk::algorithms::verify_eval<lpc_type>(
+                    evaluation_points, proof, zk::algorithms::commit<lpc_type>(tree), fri_params, transcript);
+            });
+            BOOST_CHECK(verified);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE pedersen_benchmark
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/mnt4.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/pedersen.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+struct bls12_381_setup {
+    typedef algebra::curves::bls12<381> curve_type;
+    constexpr static const char *name = "bls12_381";
+};
+
+struct mnt4_298_setup {
+    typedef algebra::curves::mnt4<298> curve_type;
+    constexpr static const char *name = "mnt4_298";
+};
+
+typedef boost::mpl::list<bls12_381_setup, mnt4_298_setup> setups;
+
+BOOST_AUTO_TEST_SUITE(pedersen_benchmark_suite)
+
+// The domain is the number of parties n, any k = n / 2 + 1 of them open the secret
+BOOST_AUTO_TEST_CASE_TEMPLATE(pedersen_benchmark, SetupType, setups) {
+    typedef zk::commitments::pedersen<typename SetupType::curve_type> pedersen_type;
+    typedef typename pedersen_type::field_type field_type;
+    typedef typename pedersen_type::group_type group_type;
+
+    typename pedersen_type::params_type params;
+    params.g = algebra::random_element<group_type>();
+    params.h = algebra::random_element<group_type>();
+    while (params.g == params.h) {
+        params.h = algebra::random_element<group_type>();
+    }
+
+    for (std::size_t log_size : zk::benchmark::log_sizes({4, 6, 8})) {
+        params.n = 1 << log_size;
+        params.k = params.n / 2 + 1;
+
+        for (std::size_t batch_size : zk::benchmark::batch_sizes({1, 16})) {
+            std::vector<typename field_type::value_type> secrets(batch_size);
+            for (auto &secret : secrets) {
+                secret = algebra::random_element<field_type>();
+            }
+
+            std::vector<typename pedersen_type::proof_type> proofs(batch_size);
+            zk::benchmark::run("pedersen_prove", SetupType::name, params.n, batch_size, [&]() {
+                for (std::size_t i = 0; i < batch_size; i++) {
+                    proofs[i] = pedersen_type::proof_eval(params, secrets[i]);
+                }
+            });
+
+            bool verified = true;
+            zk::benchmark::run("pedersen_verify", SetupType::name, params.n, batch_size, [&]() {
+                verified = true;
+                for (std::size_t i = 0; i < batch_size; i++) {
+                    verified = pedersen_type::verify_eval(params, proofs[i]) && verified;
+                }
+            });
+            BOOST_CHECK(verified);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
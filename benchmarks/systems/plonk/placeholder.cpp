@@ -0,0 +1,225 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE placeholder_benchmark
+
+#include <array>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/params.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/gate.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/copy_constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/lookup_constraint.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/batch_prover.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/verifier.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+struct pallas_setup {
+    typedef algebra::curves::pallas::base_field_type field_type;
+    constexpr static const char *name = "pallas_base";
+};
+
+struct bls12_381_setup {
+    typedef algebra::curves::bls12<381>::scalar_field_type field_type;
+    constexpr static const char *name = "bls12_381_scalar";
+};
+
+typedef boost::mpl::list<pallas_setup, bls12_381_setup> setups;
+
+typedef plonk_arithmetization_params<3, 1, 0, 2> arithmetization_params;
+
+template<typename FieldType>
+struct add_mul_circuit {
+    typedef placeholder_params<FieldType, arithmetization_params> params_type;
+    typedef detail::placeholder_policy<FieldType, params_type> policy_type;
+
+    typename policy_type::variable_assignment_type table;
+    std::vector<plonk_gate<FieldType, plonk_constraint<FieldType>>> gates;
+    std::vector<plonk_copy_constraint<FieldType>> copy_constraints;
+    std::vector<plonk_gate<FieldType, plonk_lookup_constraint<FieldType>>> lookup_gates;
+};
+
+//---------------------------------------------------------------------------//
+// The circuit of the placeholder tests with an arbitrary number of rows
+//  i  | GATE | w_0 | w_1 | w_2 | public | q_add | q_mul |
+//  0  |  --  |  x  |  y  |  z  |   p1   |   0   |   0   |
+//  1  | ADD  |  x  |  y  |  z  |   0    |   1   |   0   |
+// ... | ADD  |  x  |  y  |  z  |   0    |   1   |   0   |
+// k-2 | MUL  |  x  |  y  |  z  |   0    |   0   |   1   |
+// k-1 | MUL  |  x  |  y  |  z  |   0    |   0   |   1   |
+//
+// ADD: x + y = z, copy(prev(z), y)
+// MUL: x * y + prev(x) = z, copy(p1, y)
+//---------------------------------------------------------------------------//
+template<typename FieldType>
+add_mul_circuit<FieldType> generate_add_mul_circuit(std::size_t rows) {
+    typedef typename FieldType::value_type value_type;
+    typedef plonk_variable<FieldType> variable_type;
+
+    add_mul_circuit<FieldType> circuit;
+    const value_type one = value_type::one();
+
+    std::array<plonk_column<FieldType>, 3> witness;
+    std::array<plonk_column<FieldType>, 1> public_input;
+    std::array<plonk_column<FieldType>, 0> constant = {};
+    std::array<plonk_column<FieldType>, 2> selectors;
+    for (auto &column : witness) {
+        column.resize(rows, value_type::zero());
+    }
+    public_input[0].resize(rows, value_type::zero());
+    selectors[0].resize(rows, value_type::zero());
+    selectors[1].resize(rows, value_type::zero());
+
+    for (std::size_t j = 0; j < 3; j++) {
+        witness[j][0] = algebra::random_element<FieldType>();
+    }
+    public_input[0][0] = algebra::random_element<FieldType>();
+
+    for (std::size_t i = 1; i < rows - 5; i++) {
+        witness[0][i] = algebra::random_element<FieldType>();
+        witness[1][i] = witness[2][i - 1];
+        witness[2][i] = witness[0][i] + witness[1][i];
+        selectors[0][i] = one;
+
+        circuit.copy_constraints.push_back(plonk_copy_constraint<FieldType>(
+            variable_type(1, i, false, variable_type::column_type::witness),
+            variable_type(2, i - 1, false, variable_type::column_type::witness)));
+    }
+
+    for (std::size_t i = rows - 5; i < rows - 3; i++) {
+        witness[0][i] = algebra::random_element<FieldType>();
+        witness[1][i] = public_input[0][0];
+        witness[2][i] = witness[0][i] * witness[1][i] + witness[0][i - 1];
+        selectors[1][i] = one;
+
+        circuit.copy_constraints.push_back(plonk_copy_constraint<FieldType>(
+            variable_type(1, i, false, variable_type::column_type::witness),
+            variable_type(0, 0, false, variable_type::column_type::public_input)));
+    }
+
+    circuit.table = plonk_assignment_table<FieldType, arithmetization_params>(
+        plonk_private_assignment_table<FieldType, arithmetization_params>(witness),
+        plonk_public_assignment_table<FieldType, arithmetization_params>(public_input, constant, selectors));
+
+    variable_type w0(0, 0, true, variable_type::column_type::witness);
+    variable_type w1(1, 0, true, variable_type::column_type::witness);
+    variable_type w2(2, 0, true, variable_type::column_type::witness);
+    variable_type w0_prev(0, -1, true, variable_type::column_type::witness);
+
+    plonk_constraint<FieldType> add_constraint;
+    add_constraint.add_term(w0);
+    add_constraint.add_term(w1);
+    add_constraint.add_term(w2, -one);
+    std::vector<plonk_constraint<FieldType>> add_gate_constraints {add_constraint};
+    circuit.gates.push_back(plonk_gate<FieldType, plonk_constraint<FieldType>>(0, add_gate_constraints));
+
+    plonk_constraint<FieldType> mul_constraint;
+    typename plonk_constraint<FieldType>::term_type w0_term(w0);
+    typename plonk_constraint<FieldType>::term_type w1_term(w1);
+    mul_constraint.add_term(w0_term * w1_term);
+    mul_constraint.add_term(w2, -one);
+    mul_constraint.add_term(w0_prev);
+    std::vector<plonk_constraint<FieldType>> mul_gate_constraints {mul_constraint};
+    circuit.gates.push_back(plonk_gate<FieldType, plonk_constraint<FieldType>>(1, mul_gate_constraints));
+
+    return circuit;
+}
+
+BOOST_AUTO_TEST_SUITE(placeholder_benchmark_suite)
+
+// The domain is the number of rows, every iteration proves or verifies a batch of tables of the same circuit
+BOOST_AUTO_TEST_CASE_TEMPLATE(placeholder_benchmark, SetupType, setups) {
+    typedef typename SetupType::field_type FieldType;
+    typedef typename add_mul_circuit<FieldType>::params_type params_type;
+    typedef typename add_mul_circuit<FieldType>::policy_type policy_type;
+
+    constexpr static const std::size_t expand_factor = 4;
+    const std::size_t columns_with_copy_constraints = 4;
+
+    for (std::size_t log_size : zk::benchmark::log_sizes({8, 10, 12})) {
+        const std::size_t rows = std::size_t(1) << log_size;
+
+        typename params_type::commitment_params_type fri_params;
+        fri_params.r = log_size - 1;
+        fri_params.D = math::calculate_domain_set<FieldType>(log_size + expand_factor, fri_params.r);
+        fri_params.max_degree = rows - 1;
+        fri_params.step_list = std::vector<std::size_t>(fri_params.r, 1);
+
+        add_mul_circuit<FieldType> circuit = generate_add_mul_circuit<FieldType>(rows);
+
+        plonk_table_description<FieldType, arithmetization_params> desc;
+        desc.rows_amount = rows;
+        desc.usable_rows_amount = rows - 3;
+
+        typename policy_type::constraint_system_type constraint_system(circuit.gates, circuit.copy_constraints,
+                                                                       circuit.lookup_gates);
+
+        typename placeholder_public_preprocessor<FieldType, params_type>::preprocessed_data_type
+            preprocessed_public_data = placeholder_public_preprocessor<FieldType, params_type>::process(
+                constraint_system, circuit.table.public_table(), desc, fri_params, columns_with_copy_constraints);
+
+        for (std::size_t batch_size : zk::benchmark::batch_sizes({1, 4})) {
+            std::vector<typename policy_type::variable_assignment_type> assignments(batch_size, circuit.table);
+
+            std::vector<placeholder_proof<FieldType, params_type>> proofs;
+            zk::benchmark::run("placeholder_prove", SetupType::name, rows, batch_size, [&]() {
+                proofs = placeholder_batch_prover<FieldType, params_type>::process(
+                    preprocessed_public_data, desc, constraint_system, assignments, fri_params);
+            });
+
+            bool verified = true;
+            zk::benchmark::run("placeholder_verify", SetupType::name, rows, batch_size, [&]() {
+                verified = true;
+                for (const auto &proof : proofs) {
+                    verified = placeholder_verifier<FieldType, params_type>::process(
+                                   preprocessed_public_data, proof, constraint_system, fri_params) &&
+                               verified;
+                }
+            });
+            BOOST_CHECK(verified);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
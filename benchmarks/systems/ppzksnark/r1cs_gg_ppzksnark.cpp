@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_gg_ppzksnark_benchmark
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/mnt4.hpp>
+#include <nil/crypto3/algebra/pairing/mnt4.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/prepared_proving_key.hpp>
+#include <nil/crypto3/zk/algorithms/generate.hpp>
+#include <nil/crypto3/zk/algorithms/prove.hpp>
+#include <nil/crypto3/zk/algorithms/verify.hpp>
+
+#include "systems/ppzksnark/r1cs_examples.hpp"
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+struct bls12_381_setup {
+    typedef algebra::curves::bls12<381> curve_type;
+    constexpr static const char *name = "bls12_381";
+};
+
+struct mnt4_298_setup {
+    typedef algebra::curves::mnt4<298> curve_type;
+    constexpr static const char *name = "mnt4_298";
+};
+
+typedef boost::mpl::list<bls12_381_setup, mnt4_298_setup> setups;
+
+BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_benchmark_suite)
+
+// The domain is the number of constraints, every iteration proves or verifies a batch of proofs
+// of the same circuit
+BOOST_AUTO_TEST_CASE_TEMPLATE(r1cs_gg_ppzksnark_benchmark, SetupType, setups) {
+    typedef typename SetupType::curve_type curve_type;
+    typedef r1cs_gg_ppzksnark<curve_type> proof_system_type;
+
+    constexpr static const std::size_t input_size = 10;
+
+    for (std::size_t log_size : zk::benchmark::log_sizes({8, 10, 12})) {
+        const std::size_t num_constraints = std::size_t(1) << log_size;
+
+        r1cs_example<typename curve_type::scalar_field_type> example =
+            generate_r1cs_example_with_binary_input<typename curve_type::scalar_field_type>(num_constraints,
+                                                                                           input_size);
+
+        typename proof_system_type::keypair_type keypair =
+            zk::generate<proof_system_type>(example.constraint_system);
+
+        const r1cs_gg_ppzksnark_prepared_proving_key<curve_type> prepared_key(keypair.first);
+
+        for (std::size_t batch_size : zk::benchmark::batch_sizes({1, 4})) {
+            std::vector<typename proof_system_type::proof_type> proofs(batch_size);
+            zk::benchmark::run("r1cs_gg_ppzksnark_prove", SetupType::name, num_constraints, batch_size, [&]() {
+                for (std::size_t i = 0; i < batch_size; i++) {
+                    proofs[i] = zk::prove<proof_system_type>(keypair.first, example.primary_input,
+                                                             example.auxiliary_input);
+                }
+            });
+
+            zk::benchmark::run("r1cs_gg_ppzksnark_prepared_prove", SetupType::name, num_constraints, batch_size,
+                               [&]() {
+                                   for (std::size_t i = 0; i < batch_size; i++) {
+                                       proofs[i] = r1cs_gg_ppzksnark_prover<curve_type>::process(
+                                           prepared_key, example.primary_input, example.auxiliary_input);
+                                   }
+                               });
+
+            bool verified = true;
+            zk::benchmark::run("r1cs_gg_ppzksnark_verify", SetupType::name, num_constraints, batch_size, [&]() {
+                verified = true;
+                for (std::size_t i = 0; i < batch_size; i++) {
+                    verified =
+                        zk::verify<proof_system_type>(keypair.second, example.primary_input, proofs[i]) && verified;
+                }
+            });
+            BOOST_CHECK(verified);
+
+            const std::vector<typename proof_system_type::primary_input_type> primary_inputs(
+                batch_size, example.primary_input);
+            zk::benchmark::run("r1cs_gg_ppzksnark_batch_verify", SetupType::name, num_constraints, batch_size, [&]() {
+                verified = r1cs_gg_ppzksnark_batch_verifier<curve_type>::process(keypair.second, primary_inputs,
+                                                                                 proofs);
+            });
+            BOOST_CHECK(verified);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE transcript_benchmark
+
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+
+#include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3;
+
+template<typename FieldType, typename HashType>
+struct transcript_setup {
+    typedef FieldType field_type;
+    typedef HashType hash_type;
+};
+
+struct pallas_sha2_setup
+    : transcript_setup<algebra::curves::pallas::base_field_type, hashes::sha2<256>> {
+    constexpr static const char *name = "pallas_base/sha2_256";
+};
+
+struct pallas_keccak_setup
+    : transcript_setup<algebra::curves::pallas::base_field_type, hashes::keccak_1600<512>> {
+    constexpr static const char *name = "pallas_base/keccak_1600_512";
+};
+
+struct bls12_381_keccak_setup
+    : transcript_setup<algebra::curves::bls12<381>::scalar_field_type, hashes::keccak_1600<512>> {
+    constexpr static const char *name = "bls12_381_scalar/keccak_1600_512";
+};
+
+typedef boost::mpl::list<pallas_sha2_setup, pallas_keccak_setup, bls12_381_keccak_setup> setups;
+
+BOOST_AUTO_TEST_SUITE(transcript_benchmark_suite)
+
+// The domain is the size in bytes of an absorbed message, every round absorbs a batch of messages
+// and squeezes one challenge
+BOOST_AUTO_TEST_CASE_TEMPLATE(fiat_shamir_sequential_benchmark, SetupType, setups) {
+    typedef typename SetupType::field_type field_type;
+
+    const std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    for (std::size_t log_size : zk::benchmark::log_sizes({5, 10, 15})) {
+        const std::size_t message_size = std::size_t(1) << log_size;
+        std::vector<std::uint8_t> message(message_size);
+        for (std::size_t i = 0; i < message_size; i++) {
+            message[i] = static_cast<std::uint8_t>(i);
+        }
+
+        for (std::size_t batch_size : zk::benchmark::batch_sizes({1, 16})) {
+            zk::transcript::fiat_shamir_heuristic_sequential<typename SetupType::hash_type> transcript(init_blob);
+            typename field_type::value_type challenge;
+
+            zk::benchmark::run("fiat_shamir_sequential", SetupType::name, message_size, batch_size, [&]() {
+                for (std::size_t i = 0; i < batch_size; i++) {
+                    transcript(message);
+                }
+                challenge = transcript.template challenge<field_type>();
+            });
+            BOOST_CHECK(challenge != field_type::value_type::zero());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(fiat_shamir_sponge_benchmark, SetupType, setups) {
+    typedef typename SetupType::field_type field_type;
+
+    const std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    for (std::size_t log_size : zk::benchmark::log_sizes({5, 10, 15})) {
+        const std::size_t message_size = std::size_t(1) << log_size;
+        std::vector<std::uint8_t> message(message_size);
+        for (std::size_t i = 0; i < message_size; i++) {
+            message[i] = static_cast<std::uint8_t>(i);
+        }
+
+        for (std::size_t batch_size : zk::benchmark::batch_sizes({1, 16})) {
+            zk::transcript::fiat_shamir_heuristic_sponge<typename SetupType::hash_type> transcript(init_blob);
+            typename field_type::value_type challenge;
+
+            zk::benchmark::run("fiat_shamir_sponge", SetupType::name, message_size, batch_size, [&]() {
+                for (std::size_t i = 0; i < batch_size; i++) {
+                    transcript(message);
+                }
+                challenge = transcript.template challenge<field_type>();
+            });
+            BOOST_CHECK(challenge != field_type::value_type::zero());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
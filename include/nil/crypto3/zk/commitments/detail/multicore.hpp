@@ -0,0 +1,58 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_DETAIL_MULTICORE_HPP
+#define CRYPTO3_ZK_COMMITMENTS_DETAIL_MULTICORE_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+
+#ifdef MULTICORE
+                    /*
+                     * Number of threads of the parallel prover and commitment loops, also used as the number of
+                     * chunks of the chunked ones. ZK_MULTICORE_THREADS is set by the ZK_MULTICORE_THREADS CMake
+                     * cache variable, 0 leaves the choice to OpenMP (OMP_NUM_THREADS).
+                     */
+                    inline int multicore_threads() {
+#if defined(ZK_MULTICORE_THREADS) && ZK_MULTICORE_THREADS > 0
+                        return ZK_MULTICORE_THREADS;
+#else
+                        return omp_get_max_threads();
+#endif
+                    }
+#endif
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_DETAIL_MULTICORE_HPP
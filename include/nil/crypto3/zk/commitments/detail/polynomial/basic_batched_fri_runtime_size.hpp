@@ -62,7 +62,8 @@ namespace nil {
                     template<typename FieldType,
                              typename MerkleTreeHashType,
                              typename TranscriptHashType,
-                             std::size_t M = 2>
+                             std::size_t M = 2,
+                             typename TranscriptType = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>>
                     struct basic_batched_fri_runtime_size {
 
                         constexpr static const std::size_t m = M;
@@ -81,7 +82,7 @@ namespace nil {
 
                         using precommitment_type = merkle_tree_type;
                         using commitment_type = typename precommitment_type::value_type;
-                        using transcript_type = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>;
+                        using transcript_type = TranscriptType;
             			using params_type = typename basic_fri<FieldType, MerkleTreeHashType,
             				TranscriptHashType, M>::params_type;
 
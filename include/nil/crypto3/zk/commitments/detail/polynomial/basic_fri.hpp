@@ -44,6 +44,8 @@
 
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/fold_polynomial.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/leaves_buffer.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/parallel_merkle_tree.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -56,6 +58,7 @@ namespace nil {
                      * @brief Based on the FRI Commitment description from \[ResShift].
                      * @tparam d ...
                      * @tparam Rounds Denoted by r in \[Placeholder].
+                     * @tparam TranscriptType Fiat-Shamir transcript, fiat_shamir_heuristic_sequential by default.
                      *
                      * References:
                      * \[Placeholder]:
@@ -66,7 +69,8 @@ namespace nil {
                      * <https://eprint.iacr.org/2019/1400.pdf>
                      */
                     template<typename FieldType, typename MerkleTreeHashType, typename TranscriptHashType,
-                             std::size_t M, std::size_t BatchSize, bool IsConstSize>
+                             std::size_t M, std::size_t BatchSize, bool IsConstSize,
+                             typename TranscriptType = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>>
                     struct basic_batched_fri {
                         BOOST_STATIC_ASSERT_MSG(M == 2, "unsupported m value!");
 
@@ -94,7 +98,8 @@ namespace nil {
 
                         using precommitment_type = merkle_tree_type;
                         using commitment_type = typename precommitment_type::value_type;
-                        using transcript_type = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>;
+                        using leaves_buffer_type = leaves_buffer;
+                        using transcript_type = TranscriptType;
 
                         struct params_type {
                             bool operator==(const params_type &rhs) const {
@@ -107,7 +112,7 @@ namespace nil {
                             // TODO: Better if we can construct params_type from any batch size to another
                             params_type(
                                 const typename basic_batched_fri<FieldType, MerkleTreeHashType, TranscriptHashType, M,
-                                                                 1, false>::params_type &obj) {
+                                                                 1, false, TranscriptType>::params_type &obj) {
                                 r = obj.r;
                                 max_degree = obj.max_degree;
                                 D = obj.D;
@@ -116,7 +121,7 @@ namespace nil {
 
                             params_type(
                                 const typename basic_batched_fri<FieldType, MerkleTreeHashType, TranscriptHashType, M,
-                                                                 1, true>::params_type &obj) {
+                                                                 1, true, TranscriptType>::params_type &obj) {
                                 r = obj.r;
                                 max_degree = obj.max_degree;
                                 D = obj.D;
@@ -187,7 +192,8 @@ namespace nil {
                              std::is_base_of<
                                  commitments::detail::basic_batched_fri<
                                      typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
+                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                     typename FRI::transcript_type>,
                                  FRI>::value,
                              bool>::type = true>
                 static typename FRI::commitment_type commit(const typename FRI::precommitment_type &P) {
@@ -199,7 +205,8 @@ namespace nil {
                              std::is_base_of<
                                  commitments::detail::basic_batched_fri<
                                      typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
+                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                     typename FRI::transcript_type>,
                                  FRI>::value,
                              bool>::type = true>
                 static std::array<typename FRI::commitment_type, list_size>
@@ -217,19 +224,49 @@ namespace nil {
                     return (x_index + domain_size / FRI::m) % domain_size;
                 }
 
+                /**
+                 * Indices of the coset committed in one leaf, in the same order as calculate_s:
+                 * [0, N/4, N/8, N/8 + N/4, N/16, N/16 + N/4, N/16 + N/8, N/16 + N/8 + N/4 ...] shifted by x_index
+                 */
+                template<typename FRI>
+                static inline std::vector<std::array<std::size_t, FRI::m>>
+                    get_coset_indices(const std::size_t x_index, const std::size_t domain_size,
+                                      const std::size_t fri_step) {
+                    const std::size_t coset_size = 1 << fri_step;
+                    std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
+                    s_indices[0][0] = x_index;
+                    s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
+
+                    std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                    std::size_t prev_half_size = 1;
+                    std::size_t i = 1;
+                    while (i < coset_size / FRI::m) {
+                        for (std::size_t j = 0; j < prev_half_size; j++) {
+                            s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
+                            s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
+                            i++;
+                        }
+                        base_index /= FRI::m;
+                        prev_half_size <<= 1;
+                    }
+                    return s_indices;
+                }
+
                 template<typename FRI,
                          typename std::enable_if<
                              std::is_base_of<
                                  commitments::detail::basic_batched_fri<
                                      typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
+                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                     typename FRI::transcript_type>,
                                  FRI>::value,
                              bool>::type = true>
                 static typename FRI::precommitment_type
                     precommit(math::polynomial_dfs<typename FRI::field_type::value_type> &f,
                               std::shared_ptr<math::evaluation_domain<typename FRI::field_type>>
                                   D,
-                              const std::size_t fri_step) {
+                              const std::size_t fri_step,
+                              typename FRI::leaves_buffer_type &leaves) {
 
                     if (f.size() != D->size()) {
                         f.resize(D->size());
@@ -237,42 +274,42 @@ namespace nil {
                     std::size_t domain_size = D->size();
                     std::size_t coset_size = 1 << fri_step;
                     std::size_t leafs_number = domain_size / coset_size;
-                    std::size_t leaf_bytes = coset_size * FRI::field_element_type::length();
-                    std::vector<std::vector<std::uint8_t>> y_data(leafs_number, std::vector<std::uint8_t>(leaf_bytes));
+                    leaves.reset(leafs_number, coset_size * FRI::field_element_type::length());
 
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
                     for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                        s_indices[0][0] = x_index;
-                        s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                        auto write_iter = y_data[x_index].begin();
-                        typename FRI::field_element_type y_val0(f[s_indices[0][0]]);
-                        y_val0.write(write_iter, FRI::field_element_type::length());
-                        typename FRI::field_element_type y_val1(f[s_indices[0][1]]);
-                        y_val1.write(write_iter, FRI::field_element_type::length());
-
-                        std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                        std::size_t prev_half_size = 1;
-                        std::size_t i = 1;
-                        while (i < coset_size / FRI::m) {
-                            for (std::size_t j = 0; j < prev_half_size; j++) {
-                                s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-
-                                typename FRI::field_element_type y_val0(f[s_indices[i][0]]);
-                                y_val0.write(write_iter, FRI::field_element_type::length());
-                                typename FRI::field_element_type y_val1(f[s_indices[i][1]]);
-                                y_val1.write(write_iter, FRI::field_element_type::length());
-
-                                i++;
-                            }
-                            base_index /= FRI::m;
-                            prev_half_size <<= 1;
+                        auto write_iter = leaves.leaf_data(x_index);
+                        for (const auto &indices : get_coset_indices<FRI>(x_index, domain_size, fri_step)) {
+                            typename FRI::field_element_type y_val0(f[indices[0]]);
+                            y_val0.write(write_iter, FRI::field_element_type::length());
+                            typename FRI::field_element_type y_val1(f[indices[1]]);
+                            y_val1.write(write_iter, FRI::field_element_type::length());
                         }
                     }
 
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    const auto &leaves_ranges = leaves.leaves_ranges();
+                    return commitments::detail::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(
+                        leaves_ranges.begin(), leaves_ranges.end());
+                }
+
+                template<typename FRI,
+                         typename std::enable_if<
+                             std::is_base_of<
+                                 commitments::detail::basic_batched_fri<
+                                     typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                     typename FRI::transcript_type>,
+                                 FRI>::value,
+                             bool>::type = true>
+                static typename FRI::precommitment_type
+                    precommit(math::polynomial_dfs<typename FRI::field_type::value_type> &f,
+                              std::shared_ptr<math::evaluation_domain<typename FRI::field_type>>
+                                  D,
+                              const std::size_t fri_step) {
+                    typename FRI::leaves_buffer_type leaves;
+                    return precommit<FRI>(f, D, fri_step, leaves);
                 }
 
                 template<typename FRI,
@@ -280,7 +317,8 @@ namespace nil {
                              std::is_base_of<
                                  commitments::detail::basic_batched_fri<
                                      typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
+                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                     typename FRI::transcript_type>,
                                  FRI>::value,
                              bool>::type = true>
                 static typename FRI::precommitment_type
@@ -299,7 +337,8 @@ namespace nil {
                              std::is_base_of<
                                  commitments::detail::basic_batched_fri<
                                      typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
+                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                     typename FRI::transcript_type>,
                                  FRI>::value,
                              bool>::type = true>
                 static typename std::enable_if<
@@ -308,7 +347,8 @@ namespace nil {
                     typename FRI::precommitment_type>::type
                     precommit(ContainerType poly,
                               const std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> &D,
-                              const std::size_t fri_step) {
+                              const std::size_t fri_step,
+                              typename FRI::leaves_buffer_type &leaves) {
 
 #ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
                     auto begin = std::chrono::high_resolution_clock::now();
@@ -327,45 +367,49 @@ namespace nil {
                     std::size_t list_size = poly.size();
                     std::size_t coset_size = 1 << fri_step;
                     std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<std::vector<std::uint8_t>> y_data(
-                        leafs_number,
-                        std::vector<std::uint8_t>(coset_size * FRI::field_element_type::length() * list_size));
+                    leaves.reset(leafs_number, coset_size * FRI::field_element_type::length() * list_size);
 
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
                     for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        auto write_iter = y_data[x_index].begin();
+                        // Coset indices do not depend on the polynomial, so they are shared by the whole leaf
+                        const std::vector<std::array<std::size_t, FRI::m>> s_indices =
+                            get_coset_indices<FRI>(x_index, domain_size, fri_step);
+                        auto write_iter = leaves.leaf_data(x_index);
                         for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
-                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                            s_indices[0][0] = x_index;
-                            s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                            typename FRI::field_element_type y_val0(poly[polynom_index][s_indices[0][0]]);
-                            y_val0.write(write_iter, FRI::field_element_type::length());
-                            typename FRI::field_element_type y_val1(poly[polynom_index][s_indices[0][1]]);
-                            y_val1.write(write_iter, FRI::field_element_type::length());
-
-                            std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                            std::size_t prev_half_size = 1;
-                            std::size_t i = 1;
-                            while (i < coset_size / FRI::m) {
-                                for (std::size_t j = 0; j < prev_half_size; j++) {
-                                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                    s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-
-                                    typename FRI::field_element_type y_val0(poly[polynom_index][s_indices[i][0]]);
-                                    y_val0.write(write_iter, FRI::field_element_type::length());
-                                    typename FRI::field_element_type y_val1(poly[polynom_index][s_indices[i][1]]);
-                                    y_val1.write(write_iter, FRI::field_element_type::length());
-
-                                    i++;
-                                }
-                                base_index /= FRI::m;
-                                prev_half_size <<= 1;
+                            for (const auto &indices : s_indices) {
+                                typename FRI::field_element_type y_val0(poly[polynom_index][indices[0]]);
+                                y_val0.write(write_iter, FRI::field_element_type::length());
+                                typename FRI::field_element_type y_val1(poly[polynom_index][indices[1]]);
+                                y_val1.write(write_iter, FRI::field_element_type::length());
                             }
                         }
                     }
 
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    const auto &leaves_ranges = leaves.leaves_ranges();
+                    return commitments::detail::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(
+                        leaves_ranges.begin(), leaves_ranges.end());
+                }
+
+                template<typename FRI, typename ContainerType,
+                         typename std::enable_if<
+                             std::is_base_of<
+                                 commitments::detail::basic_batched_fri<
+                                     typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                     typename FRI::transcript_type>,
+                                 FRI>::value,
+                             bool>::type = true>
+                static typename std::enable_if<
+                    (std::is_same<typename ContainerType::value_type,
+                                  math::polynomial_dfs<typename FRI::field_type::value_type>>::value),
+                    typename FRI::precommitment_type>::type
+                    precommit(ContainerType poly,
+                              const std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> &D,
+                              const std::size_t fri_step) {
+                    typename FRI::leaves_buffer_type leaves;
+                    return precommit<FRI>(std::move(poly), D, fri_step, leaves);
                 }
 
                 template<typename FRI, typename ContainerType,
@@ -373,7 +417,8 @@ namespace nil {
                              std::is_base_of<
                                  commitments::detail::basic_batched_fri<
                                      typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
+                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                     typename FRI::transcript_type>,
                                  FRI>::value,
                              bool>::type = true>
                 static typename std::enable_if<
@@ -382,7 +427,8 @@ namespace nil {
                     typename FRI::precommitment_type>::type
                     precommit(const ContainerType &poly,
                               const std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> &D,
-                              const std::size_t fri_step) {
+                              const std::size_t fri_step,
+                              typename FRI::leaves_buffer_type &leaves) {
 
                     std::size_t list_size = poly.size();
                     std::vector<math::polynomial_dfs<typename FRI::field_type::value_type>> poly_dfs(list_size);
@@ -391,7 +437,27 @@ namespace nil {
                         poly_dfs[i].resize(D->size());
                     }
 
-                    return precommit<FRI>(poly_dfs, D, fri_step);
+                    return precommit<FRI>(std::move(poly_dfs), D, fri_step, leaves);
+                }
+
+                template<typename FRI, typename ContainerType,
+                         typename std::enable_if<
+                             std::is_base_of<
+                                 commitments::detail::basic_batched_fri<
+                                     typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                     typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                     typename FRI::transcript_type>,
+                                 FRI>::value,
+                             bool>::type = true>
+                static typename std::enable_if<
+                    (std::is_same<typename ContainerType::value_type,
+                                  math::polynomial<typename FRI::field_type::value_type>>::value),
+                    typename FRI::precommitment_type>::type
+                    precommit(const ContainerType &poly,
+                              const std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> &D,
+                              const std::size_t fri_step) {
+                    typename FRI::leaves_buffer_type leaves;
+                    return precommit<FRI>(poly, D, fri_step, leaves);
                 }
 
                 template<typename FRI>
@@ -529,80 +595,41 @@ namespace nil {
                     return correct_order_idx;
                 }
 
-                template<
-                    typename FRI, typename ContainerType,
-                    typename std::enable_if<
-                        std::is_base_of<
-                            commitments::detail::basic_batched_fri<
-                                typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
-                            FRI>::value &&
-                            (!std::is_same_v<typename ContainerType::value_type, typename FRI::field_type::value_type>),
-                        bool>::type = true>
+                template<typename FRI, typename ContainerType>
                 static typename FRI::proof_type
-                    proof_eval(ContainerType f,
-                               ContainerType g,
-                               const typename FRI::precommitment_type &T,
-                               const typename FRI::params_type &fri_params,
-                               typename FRI::transcript_type &transcript = typename FRI::transcript_type()) {
-                    BOOST_ASSERT(check_step_list<FRI>(fri_params));
-                    BOOST_ASSERT(check_initial_precommitment<FRI>(T, fri_params));
-
-                    if constexpr (std::is_same_v<math::polynomial_dfs<typename FRI::field_type::value_type>,
-                                                 typename ContainerType::value_type>) {
-                        for (int i = 0; i < f.size(); ++i) {
-                            // BOOST_ASSERT(g[i].size() == fri_params.D[0]->size());
-                            if (f[i].size() != fri_params.D[0]->size()) {
-                                f[i].resize(fri_params.D[0]->size());
-                            }
-                            if (g[i].size() != fri_params.D[0]->size()) {
-                                g[i].resize(fri_params.D[0]->size());
-                            }
-                        }
-                    }
-
-                    BOOST_ASSERT(f.size() == g.size());
-                    std::size_t leaf_size = f.size();
-
-                    transcript(commit<FRI>(T));
-
-                    // TODO: how to sample x?
-                    std::size_t domain_size = fri_params.D[0]->size();
-                    std::uint64_t x_index = (transcript.template int_challenge<std::uint64_t>()) % domain_size;
+                    query_proof_eval(std::uint64_t x_index,
+                                     const ContainerType &g,
+                                     const typename FRI::precommitment_type &T,
+                                     const std::vector<ContainerType> &layers,
+                                     const std::vector<typename FRI::merkle_tree_type> &trees,
+                                     const typename FRI::proof_type::final_polynomials_type &final_polynomials,
+                                     const typename FRI::params_type &fri_params) {
+                    std::size_t leaf_size = g.size();
                     typename FRI::field_type::value_type x = fri_params.D[0]->get_domain_element(x_index);
 
                     std::vector<typename FRI::round_proof_type> round_proofs;
-                    std::unique_ptr<typename FRI::merkle_tree_type> p_tree =
-                        std::make_unique<typename FRI::merkle_tree_type>(T);
-                    typename FRI::merkle_tree_type T_next;
+                    typename FRI::rounds_polynomials_values_type values;
 
                     std::size_t basis_index = 0;
                     std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
                     std::vector<std::array<std::size_t, FRI::m>> s_indices;
 
-                    typename FRI::rounds_polynomials_values_type values;
-
                     for (std::size_t i = 0; i < fri_params.step_list.size() - 1; i++) {
-                        domain_size = fri_params.D[basis_index]->size();
+                        const typename FRI::merkle_tree_type &tree = (i == 0) ? T : trees[i - 1];
+                        std::size_t domain_size = fri_params.D[basis_index]->size();
                         x_index %= domain_size;
 
-                        // m = 2, so:
-                        if constexpr (FRI::m == 2) {
-                            std::tie(s, s_indices) =
-                                calculate_s<FRI>(x, x_index, fri_params.step_list[i], fri_params.D[basis_index]);
-                        } else {
-                            return {};
-                        }
-
-                        typename FRI::polynomials_values_type y;
-                        if constexpr (!FRI::is_const_size) {
-                            y.resize(leaf_size);
-                        }
+                        std::tie(s, s_indices) =
+                            calculate_s<FRI>(x, x_index, fri_params.step_list[i], fri_params.D[basis_index]);
 
                         std::size_t coset_size = 1 << fri_params.step_list[i];
                         BOOST_ASSERT(coset_size / FRI::m == s.size());
                         BOOST_ASSERT(coset_size / FRI::m == s_indices.size());
-                        if (basis_index == 0) {
+                        if (i == 0) {
+                            typename FRI::polynomials_values_type y;
+                            if constexpr (!FRI::is_const_size) {
+                                y.resize(leaf_size);
+                            }
                             for (std::size_t polynom_index = 0; polynom_index < leaf_size; polynom_index++) {
                                 y[polynom_index].resize(coset_size / FRI::m);
                                 for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
@@ -620,69 +647,126 @@ namespace nil {
                             values.push_back(y);    // y for first round
                         }
 
-                        // TODO: check if leaf index calculation is correct
                         auto p = make_proof_specialized<FRI>(
-                            get_folded_index<FRI>(x_index, domain_size, fri_params.step_list[i]), domain_size, *p_tree);
-
-                        typename FRI::polynomials_values_type colinear_value;
-                        if constexpr (!FRI::is_const_size) {
-                            colinear_value.resize(leaf_size);
-                        }
-
-                        for (std::size_t step_i = 0; step_i < fri_params.step_list[i]; step_i++, basis_index++) {
-                            typename FRI::field_type::value_type alpha =
-                                transcript.template challenge<typename FRI::field_type>();
-
-                            for (std::size_t polynom_index = 0; polynom_index < leaf_size; polynom_index++) {
-                                if constexpr (std::is_same_v<math::polynomial_dfs<typename FRI::field_type::value_type>,
-                                                             typename ContainerType::value_type>) {
-                                    if (basis_index == 0) {
-                                        f[polynom_index].resize(fri_params.D[basis_index]->size());
-                                    }
-                                    f[polynom_index] = commitments::detail::fold_polynomial<typename FRI::field_type>(
-                                        f[polynom_index], alpha, fri_params.D[basis_index]);
-                                } else {
-                                    f[polynom_index] = commitments::detail::fold_polynomial<typename FRI::field_type>(
-                                        f[polynom_index], alpha);
-                                }
-                            }
+                            get_folded_index<FRI>(x_index, domain_size, fri_params.step_list[i]), domain_size, tree);
 
-                            x_index = x_index % (fri_params.D[basis_index + 1]->size());
-                            x = fri_params.D[basis_index + 1]->get_domain_element(x_index);
-                        }
+                        // Folded domains are nested, so reducing modulo the last one is enough
+                        basis_index += fri_params.step_list[i];
+                        x_index %= fri_params.D[basis_index]->size();
+                        x = fri_params.D[basis_index]->get_domain_element(x_index);
 
                         std::tie(s, s_indices) =
                             calculate_s<FRI>(x, x_index, fri_params.step_list[i + 1], fri_params.D[basis_index]);
                         coset_size = 1 << fri_params.step_list[i + 1];
                         BOOST_ASSERT(coset_size / FRI::m == s.size());
                         BOOST_ASSERT(coset_size / FRI::m == s_indices.size());
+
+                        typename FRI::polynomials_values_type colinear_value;
+                        if constexpr (!FRI::is_const_size) {
+                            colinear_value.resize(leaf_size);
+                        }
                         for (std::size_t polynom_index = 0; polynom_index < leaf_size; polynom_index++) {
                             colinear_value[polynom_index].resize(coset_size / FRI::m);
                             for (std::size_t j = 0; j < coset_size / FRI::m; j++) {
                                 if constexpr (std::is_same_v<math::polynomial_dfs<typename FRI::field_type::value_type>,
                                                              typename ContainerType::value_type>) {
-                                    colinear_value[polynom_index][j][0] = f[polynom_index][s_indices[j][0]];
-                                    colinear_value[polynom_index][j][1] = f[polynom_index][s_indices[j][1]];
+                                    colinear_value[polynom_index][j][0] = layers[i][polynom_index][s_indices[j][0]];
+                                    colinear_value[polynom_index][j][1] = layers[i][polynom_index][s_indices[j][1]];
                                 } else {
-                                    colinear_value[polynom_index][j][0] = f[polynom_index].evaluate(s[j][0]);
-                                    colinear_value[polynom_index][j][1] = f[polynom_index].evaluate(s[j][1]);
+                                    colinear_value[polynom_index][j][0] = layers[i][polynom_index].evaluate(s[j][0]);
+                                    colinear_value[polynom_index][j][1] = layers[i][polynom_index].evaluate(s[j][1]);
                                 }
                             }
                         }
                         values.push_back(colinear_value);    // colinear_value for this iteration and y for the next.
 
-                        T_next = precommit<FRI>(f, fri_params.D[basis_index],
-                                                fri_params.step_list[i + 1]);    // new merkle tree
-                        transcript(commit<FRI>(T_next));
-
                         typename FRI::merkle_proof_type colinear_path = make_proof_specialized<FRI>(
                             get_folded_index<FRI>(x_index, fri_params.D[basis_index]->size(),
                                                   fri_params.step_list[i + 1]),
-                            fri_params.D[basis_index]->size(), T_next);
+                            fri_params.D[basis_index]->size(), trees[i]);
 
-                        round_proofs.push_back(typename FRI::round_proof_type({p, p_tree->root(), colinear_path}));
+                        round_proofs.push_back(typename FRI::round_proof_type({p, tree.root(), colinear_path}));
+                    }
 
-                        p_tree = std::make_unique<typename FRI::merkle_tree_type>(T_next);
+                    return typename FRI::proof_type({round_proofs, final_polynomials, values});
+                }
+
+                /**
+                 * Folds and commits every FRI layer once, then answers queries_number query rounds
+                 * from the cached layers and Merkle trees. All query indices are sampled after the
+                 * last layer commitment.
+                 */
+                template<
+                    typename FRI, typename ContainerType,
+                    typename std::enable_if<
+                        std::is_base_of<
+                            commitments::detail::basic_batched_fri<
+                                typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                typename FRI::transcript_type>,
+                            FRI>::value &&
+                            (!std::is_same_v<typename ContainerType::value_type, typename FRI::field_type::value_type>),
+                        bool>::type = true>
+                static std::vector<typename FRI::proof_type>
+                    multi_query_proof_eval(ContainerType f,
+                                           ContainerType g,
+                                           const typename FRI::precommitment_type &T,
+                                           const typename FRI::params_type &fri_params,
+                                           const std::size_t queries_number,
+                                           typename FRI::transcript_type &transcript = typename FRI::transcript_type()) {
+                    BOOST_ASSERT(check_step_list<FRI>(fri_params));
+                    BOOST_ASSERT(check_initial_precommitment<FRI>(T, fri_params));
+
+                    // calculate_s and the query values are only implemented for m = 2
+                    static_assert(FRI::m == 2, "unsupported m value!");
+
+                    if constexpr (std::is_same_v<math::polynomial_dfs<typename FRI::field_type::value_type>,
+                                                 typename ContainerType::value_type>) {
+                        for (int i = 0; i < f.size(); ++i) {
+                            // BOOST_ASSERT(g[i].size() == fri_params.D[0]->size());
+                            if (f[i].size() != fri_params.D[0]->size()) {
+                                f[i].resize(fri_params.D[0]->size());
+                            }
+                            if (g[i].size() != fri_params.D[0]->size()) {
+                                g[i].resize(fri_params.D[0]->size());
+                            }
+                        }
+                    }
+
+                    BOOST_ASSERT(f.size() == g.size());
+                    std::size_t leaf_size = f.size();
+
+                    transcript(commit<FRI>(T));
+
+                    // layers[i] and trees[i] hold the polynomials folded after the i-th step of step_list
+                    std::vector<ContainerType> layers;
+                    std::vector<typename FRI::merkle_tree_type> trees;
+                    layers.reserve(fri_params.step_list.size() - 1);
+                    trees.reserve(fri_params.step_list.size() - 1);
+
+                    typename FRI::leaves_buffer_type leaves;
+                    std::size_t basis_index = 0;
+                    for (std::size_t i = 0; i < fri_params.step_list.size() - 1; i++) {
+                        for (std::size_t step_i = 0; step_i < fri_params.step_list[i]; step_i++, basis_index++) {
+                            typename FRI::field_type::value_type alpha =
+                                transcript.template challenge<typename FRI::field_type>();
+
+                            for (std::size_t polynom_index = 0; polynom_index < leaf_size; polynom_index++) {
+                                if constexpr (std::is_same_v<math::polynomial_dfs<typename FRI::field_type::value_type>,
+                                                             typename ContainerType::value_type>) {
+                                    f[polynom_index] = commitments::detail::fold_polynomial<typename FRI::field_type>(
+                                        f[polynom_index], alpha, fri_params.D[basis_index]);
+                                } else {
+                                    f[polynom_index] = commitments::detail::fold_polynomial<typename FRI::field_type>(
+                                        f[polynom_index], alpha);
+                                }
+                            }
+                        }
+
+                        layers.push_back(f);
+                        trees.push_back(precommit<FRI>(f, fri_params.D[basis_index], fri_params.step_list[i + 1],
+                                                       leaves));    // new merkle tree
+                        transcript(commit<FRI>(trees.back()));
                     }
 
                     typename FRI::proof_type::final_polynomials_type final_polynomials;
@@ -701,7 +785,38 @@ namespace nil {
                             final_polynomials[polynom_index] = f[polynom_index];
                         }
                     }
-                    return typename FRI::proof_type({round_proofs, final_polynomials, values});
+
+                    std::vector<typename FRI::proof_type> proofs;
+                    proofs.reserve(queries_number);
+                    for (std::size_t query_id = 0; query_id < queries_number; query_id++) {
+                        std::uint64_t x_index =
+                            (transcript.template int_challenge<std::uint64_t>()) % fri_params.D[0]->size();
+                        proofs.push_back(
+                            query_proof_eval<FRI>(x_index, g, T, layers, trees, final_polynomials, fri_params));
+                    }
+
+                    return proofs;
+                }
+
+                template<
+                    typename FRI, typename ContainerType,
+                    typename std::enable_if<
+                        std::is_base_of<
+                            commitments::detail::basic_batched_fri<
+                                typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                typename FRI::transcript_type>,
+                            FRI>::value &&
+                            (!std::is_same_v<typename ContainerType::value_type, typename FRI::field_type::value_type>),
+                        bool>::type = true>
+                static typename FRI::proof_type
+                    proof_eval(ContainerType f,
+                               ContainerType g,
+                               const typename FRI::precommitment_type &T,
+                               const typename FRI::params_type &fri_params,
+                               typename FRI::transcript_type &transcript = typename FRI::transcript_type()) {
+                    return std::move(
+                        multi_query_proof_eval<FRI>(std::move(f), std::move(g), T, fri_params, 1, transcript).front());
                 }
 
                 template<
@@ -710,7 +825,8 @@ namespace nil {
                         std::is_base_of<
                             commitments::detail::basic_batched_fri<
                                 typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
+                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                typename FRI::transcript_type>,
                             FRI>::value &&
                             (std::is_same_v<typename PolynomType::value_type, typename FRI::field_type::value_type>),
                         bool>::type = true>
@@ -732,7 +848,8 @@ namespace nil {
                         std::is_base_of<
                             commitments::detail::basic_batched_fri<
                                 typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
+                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                typename FRI::transcript_type>,
                             FRI>::value &&
                             (!std::is_same_v<typename ContainerType::value_type, typename FRI::field_type::value_type>),
                         bool>::type = true>
@@ -753,7 +870,8 @@ namespace nil {
                         std::is_base_of<
                             commitments::detail::basic_batched_fri<
                                 typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
+                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                typename FRI::transcript_type>,
                             FRI>::value &&
                             (std::is_same_v<typename PolynomType::value_type, typename FRI::field_type::value_type>),
                         bool>::type = true>
@@ -772,23 +890,14 @@ namespace nil {
                     return proof_eval<FRI>(f_new, g_new, fri_params, transcript);
                 }
 
-                template<
-                    typename FRI, typename ContainerType,
-                    typename std::enable_if<
-                        std::is_base_of<
-                            commitments::detail::basic_batched_fri<
-                                typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size>,
-                            FRI>::value &&
-                            !std::is_same_v<typename ContainerType::value_type, typename FRI::field_type::value_type>,
-                        bool>::type = true>
-                static bool verify_eval(typename FRI::proof_type &proof,
-                                        typename FRI::params_type &fri_params,
-                                        const typename FRI::commitment_type &t_polynomials,
-                                        const ContainerType &U,
-                                        const ContainerType &V,
-                                        typename FRI::transcript_type &transcript = typename FRI::transcript_type()) {
-                    BOOST_ASSERT(check_step_list<FRI>(fri_params));
+                template<typename FRI, typename ContainerType>
+                static bool verify_query(typename FRI::proof_type &proof,
+                                         const typename FRI::params_type &fri_params,
+                                         const typename FRI::commitment_type &t_polynomials,
+                                         const ContainerType &U,
+                                         const ContainerType &V,
+                                         std::uint64_t x_index,
+                                         const std::vector<typename FRI::field_type::value_type> &alphas) {
                     BOOST_ASSERT(U.size() == V.size());
 
                     std::size_t leaf_size;
@@ -798,16 +907,15 @@ namespace nil {
                         leaf_size = FRI::leaf_size;
                     }
 
-                    transcript(t_polynomials);
+                    if (proof.round_proofs.size() != fri_params.step_list.size() - 1) {
+                        return false;
+                    }
 
                     std::size_t domain_size = fri_params.D[0]->size();
-                    std::uint64_t x_index = (transcript.template int_challenge<std::uint64_t>()) % domain_size;
                     typename FRI::field_type::value_type x = fri_params.D[0]->get_domain_element(x_index);
                     std::uint64_t x_index_next;
                     typename FRI::field_type::value_type x_next;
 
-                    std::size_t r = fri_params.r;
-
                     std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
                     std::vector<std::array<std::size_t, FRI::m>> s_indices;
 
@@ -847,6 +955,7 @@ namespace nil {
                     }
 
                     std::size_t basis_index = 0;
+                    std::size_t alpha_index = 0;
                     for (std::size_t i = 0; i < fri_params.step_list.size() - 1; i++) {
                         domain_size = fri_params.D[basis_index]->size();
                         x_index %= domain_size;
@@ -907,8 +1016,7 @@ namespace nil {
                             }
                         }
                         for (std::size_t step_i = 0; step_i < fri_params.step_list[i] - 1; step_i++, basis_index++) {
-                            typename FRI::field_type::value_type alpha =
-                                transcript.template challenge<typename FRI::field_type>();
+                            const typename FRI::field_type::value_type &alpha = alphas[alpha_index++];
 
                             for (std::size_t polynom_index = 0; polynom_index < leaf_size; polynom_index++) {
                                 typename FRI::polynomial_values_type y_poly_i_new(y[polynom_index].size() / FRI::m);
@@ -955,8 +1063,7 @@ namespace nil {
                         std::vector<std::uint8_t> leaf_data(coset_size * FRI::field_element_type::length() * leaf_size);
                         auto write_iter = leaf_data.begin();
 
-                        typename FRI::field_type::value_type alpha =
-                            transcript.template challenge<typename FRI::field_type>();
+                        const typename FRI::field_type::value_type &alpha = alphas[alpha_index++];
                         for (std::size_t polynom_index = 0; polynom_index < leaf_size; polynom_index++) {
                             BOOST_ASSERT(y[polynom_index].size() == 1);
                             std::vector<
@@ -984,7 +1091,6 @@ namespace nil {
                             }
                         }
 
-                        transcript(proof.round_proofs[i].colinear_path.root());
                         if (!proof.round_proofs[i].colinear_path.validate(leaf_data)) {
                             return false;
                         }
@@ -993,25 +1099,119 @@ namespace nil {
                         x = x_next;
                     }
 
-                    auto final_root = commit<FRI>(precommit<FRI>(
-                        proof.final_polynomials, 
-                        fri_params.D[basis_index], 
-                        fri_params.step_list[fri_params.step_list.size()-1]
-                    ));
-                    if (final_root != proof.round_proofs[fri_params.step_list.size() - 2].colinear_path.root()) {
+                    return true;
+                }
+
+                /**
+                 * Verifies the query rounds produced by multi_query_proof_eval. Layer commitments are
+                 * taken from the first round, every other round must open the same layers.
+                 */
+                template<
+                    typename FRI, typename ProofsContainerType, typename ContainerType,
+                    typename std::enable_if<
+                        std::is_base_of<
+                            commitments::detail::basic_batched_fri<
+                                typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                typename FRI::transcript_type>,
+                            FRI>::value &&
+                            !std::is_same_v<typename ContainerType::value_type, typename FRI::field_type::value_type>,
+                        bool>::type = true>
+                static bool multi_query_verify_eval(ProofsContainerType &proofs,
+                                                    typename FRI::params_type &fri_params,
+                                                    const typename FRI::commitment_type &t_polynomials,
+                                                    const ContainerType &U,
+                                                    const ContainerType &V,
+                                                    typename FRI::transcript_type &transcript =
+                                                        typename FRI::transcript_type()) {
+                    BOOST_ASSERT(check_step_list<FRI>(fri_params));
+
+                    // calculate_s and the query values are only implemented for m = 2
+                    static_assert(FRI::m == 2, "unsupported m value!");
+
+                    if (proofs.empty()) {
+                        return false;
+                    }
+                    const typename FRI::proof_type &first_proof = proofs[0];
+                    const std::size_t rounds_number = fri_params.step_list.size() - 1;
+                    if (first_proof.round_proofs.size() != rounds_number) {
                         return false;
                     }
 
-                    for (std::size_t polynom_index = 0; polynom_index < leaf_size; polynom_index++) {
+                    transcript(t_polynomials);
 
-                        if (proof.final_polynomials[polynom_index].degree() >
-                            std::pow(2, std::log2(fri_params.max_degree + 1) - r + 1) - 1) {
+                    std::vector<typename FRI::field_type::value_type> alphas;
+                    alphas.reserve(fri_params.r);
+                    for (std::size_t i = 0; i < rounds_number; i++) {
+                        for (std::size_t step_i = 0; step_i < fri_params.step_list[i]; step_i++) {
+                            alphas.push_back(transcript.template challenge<typename FRI::field_type>());
+                        }
+                        transcript(first_proof.round_proofs[i].colinear_path.root());
+                    }
+
+                    for (auto &proof : proofs) {
+                        if (proof.round_proofs.size() != rounds_number) {
+                            return false;
+                        }
+                        for (std::size_t i = 0; i < rounds_number; i++) {
+                            if (proof.round_proofs[i].colinear_path.root() !=
+                                first_proof.round_proofs[i].colinear_path.root()) {
+                                return false;
+                            }
+                        }
+
+                        std::uint64_t x_index =
+                            (transcript.template int_challenge<std::uint64_t>()) % fri_params.D[0]->size();
+                        if (!verify_query<FRI>(proof, fri_params, t_polynomials, U, V, x_index, alphas)) {
+                            return false;
+                        }
+                    }
+
+                    std::size_t leaf_size;
+                    if constexpr (!FRI::is_const_size) {
+                        leaf_size = first_proof.final_polynomials.size();
+                    } else {
+                        leaf_size = FRI::leaf_size;
+                    }
+
+                    auto final_root = commit<FRI>(
+                        precommit<FRI>(first_proof.final_polynomials,
+                                       fri_params.D[fri_params.r - fri_params.step_list.back()],
+                                       fri_params.step_list.back()));
+                    if (final_root != first_proof.round_proofs[rounds_number - 1].colinear_path.root()) {
+                        return false;
+                    }
+
+                    for (std::size_t polynom_index = 0; polynom_index < leaf_size; polynom_index++) {
+                        if (first_proof.final_polynomials[polynom_index].degree() >
+                            std::pow(2, std::log2(fri_params.max_degree + 1) - fri_params.r + 1) - 1) {
                             return false;
                         }
                     }
 
                     return true;
                 }
+
+                template<
+                    typename FRI, typename ContainerType,
+                    typename std::enable_if<
+                        std::is_base_of<
+                            commitments::detail::basic_batched_fri<
+                                typename FRI::field_type, typename FRI::merkle_tree_hash_type,
+                                typename FRI::transcript_hash_type, FRI::m, FRI::leaf_size, FRI::is_const_size,
+                                typename FRI::transcript_type>,
+                            FRI>::value &&
+                            !std::is_same_v<typename ContainerType::value_type, typename FRI::field_type::value_type>,
+                        bool>::type = true>
+                static bool verify_eval(typename FRI::proof_type &proof,
+                                        typename FRI::params_type &fri_params,
+                                        const typename FRI::commitment_type &t_polynomials,
+                                        const ContainerType &U,
+                                        const ContainerType &V,
+                                        typename FRI::transcript_type &transcript = typename FRI::transcript_type()) {
+                    std::array<typename FRI::proof_type, 1> proofs = {proof};
+                    return multi_query_verify_eval<FRI>(proofs, fri_params, t_polynomials, U, V, transcript);
+                }
             }    // namespace algorithms
         }        // namespace zk
     }            // namespace crypto3
@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_GROUP_FFT_HPP
+#define CRYPTO3_ZK_COMMITMENTS_GROUP_FFT_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+                    /*!
+                     * @brief In-place radix-2 FFT of group elements with the root of unity omega of order
+                     * a.size(). Every layer of butterflies is computed in parallel.
+                     */
+                    template<typename GroupValueType, typename FieldValueType>
+                    void group_fft(std::vector<GroupValueType> &a, const FieldValueType &omega) {
+                        const std::size_t n = a.size();
+                        BOOST_ASSERT(n != 0 && (n & (n - 1)) == 0);
+
+                        std::size_t log_n = 0;
+                        while ((std::size_t(1) << log_n) < n) {
+                            ++log_n;
+                        }
+
+                        for (std::size_t i = 0; i < n; ++i) {
+                            std::size_t reversed = 0;
+                            for (std::size_t j = 0; j < log_n; ++j) {
+                                reversed |= ((i >> j) & 1) << (log_n - 1 - j);
+                            }
+                            if (i < reversed) {
+                                std::swap(a[i], a[reversed]);
+                            }
+                        }
+
+                        // omega^j for the butterflies of the last layer, the other layers take every stride-th
+                        std::vector<FieldValueType> twiddles(n / 2, FieldValueType::one());
+                        for (std::size_t j = 1; j < n / 2; ++j) {
+                            twiddles[j] = twiddles[j - 1] * omega;
+                        }
+
+                        for (std::size_t m = 1; m < n; m <<= 1) {
+                            const std::size_t stride = n / (2 * m);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t t = 0; t < n / 2; ++t) {
+                                const std::size_t j = t % m;
+                                const std::size_t k = (t / m) * 2 * m;
+
+                                const GroupValueType u = a[k + j];
+                                const GroupValueType v = j == 0 ? a[k + j + m] : twiddles[j * stride] * a[k + j + m];
+                                a[k + j] = u + v;
+                                a[k + j + m] = u - v;
+                            }
+                        }
+                    }
+
+                    /*!
+                     * @brief In-place inverse FFT of group elements over a radix-2 domain with the root of unity
+                     * omega of order a.size().
+                     */
+                    template<typename GroupValueType, typename FieldValueType>
+                    void group_inverse_fft(std::vector<GroupValueType> &a, const FieldValueType &omega) {
+                        group_fft(a, omega.inversed());
+
+                        const FieldValueType size_inverse = FieldValueType(a.size()).inversed();
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t i = 0; i < a.size(); ++i) {
+                            a[i] = size_inverse * a[i];
+                        }
+                    }
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_GROUP_FFT_HPP
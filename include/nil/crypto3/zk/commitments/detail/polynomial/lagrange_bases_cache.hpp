@@ -0,0 +1,230 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_LAGRANGE_BASES_CACHE_HPP
+#define CRYPTO3_ZK_COMMITMENTS_LAGRANGE_BASES_CACHE_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+                    /**
+                     * On-disk cache of the Lagrange bases of an SRS, keyed by the domain size.
+                     *
+                     * The stream holds a magic number, the SHA-256 digest of the SRS the bases were computed
+                     * from, the number of bases and then every basis as its domain size followed by its affine
+                     * points. Integers are little-endian 64-bit, every point is its X and Y coordinates as
+                     * little-endian field elements. The SRS digest is taken over the g points and h in the
+                     * same point encoding, a cache of another SRS is rejected on read.
+                     */
+                    template<typename GroupType>
+                    struct lagrange_bases_cache {
+                        typedef typename GroupType::value_type group_value_type;
+                        typedef typename GroupType::field_type::value_type coordinate_value_type;
+                        typedef std::unordered_map<std::size_t, std::vector<group_value_type>> bases_type;
+                        typedef hashes::sha2<256> srs_hash_type;
+                        typedef typename srs_hash_type::digest_type srs_digest_type;
+
+                        using endianness = nil::marshalling::option::little_endian;
+                        using coordinate_type = nil::crypto3::marshalling::types::
+                            field_element<nil::marshalling::field_type<endianness>, coordinate_value_type>;
+
+                        constexpr static const std::uint64_t magic_value = 0x3253455341424c4bull;    // "KLBASES2"
+
+                        /*!
+                         * @brief Digest of the SRS that binds a cache to the g points and h it was built from.
+                         */
+                        static srs_digest_type srs_digest(const std::vector<group_value_type> &g,
+                                                          const group_value_type &h) {
+                            std::vector<std::uint8_t> bytes;
+                            encode_points(g, bytes);
+                            std::vector<std::uint8_t> h_bytes;
+                            encode_points(std::vector<group_value_type> {h}, h_bytes);
+                            bytes.insert(bytes.end(), h_bytes.begin(), h_bytes.end());
+                            return nil::crypto3::hash<srs_hash_type>(bytes);
+                        }
+
+                        static bool write(std::ostream &out, const srs_digest_type &digest, const bases_type &bases) {
+                            if (!write_integer(out, magic_value) ||
+                                !out.write(reinterpret_cast<const char *>(digest.data()), digest.size()) ||
+                                !write_integer(out, bases.size())) {
+                                return false;
+                            }
+                            for (const auto &basis : bases) {
+                                if (!write_integer(out, basis.first) || !write_points(out, basis.second)) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+
+                        /*!
+                         * @brief Reads the bases from in into bases. A cache of an SRS with another digest, bases
+                         * larger than max_size, of a domain size other than a power of two, or with points not on
+                         * the curve fail the read.
+                         */
+                        static bool read(std::istream &in, const srs_digest_type &digest, bases_type &bases,
+                                         std::size_t max_size) {
+                            std::uint64_t magic, count;
+                            srs_digest_type cache_digest;
+                            if (!read_integer(in, magic) || magic != magic_value ||
+                                !in.read(reinterpret_cast<char *>(cache_digest.data()), cache_digest.size()) ||
+                                cache_digest != digest || !read_integer(in, count)) {
+                                return false;
+                            }
+                            for (std::uint64_t i = 0; i < count; ++i) {
+                                std::uint64_t size;
+                                if (!read_integer(in, size) || size == 0 || size > max_size ||
+                                    (size & (size - 1)) != 0) {
+                                    return false;
+                                }
+                                std::vector<group_value_type> basis;
+                                if (!read_points(in, size, basis)) {
+                                    return false;
+                                }
+                                bases[size] = std::move(basis);
+                            }
+                            return true;
+                        }
+
+                    private:
+                        static std::size_t coordinate_length() {
+                            return coordinate_type().length();
+                        }
+
+                        static bool write_integer(std::ostream &out, std::uint64_t value) {
+                            std::uint8_t bytes[sizeof(value)];
+                            for (std::size_t i = 0; i < sizeof(value); ++i) {
+                                bytes[i] = static_cast<std::uint8_t>(value >> (8 * i));
+                            }
+                            return bool(out.write(reinterpret_cast<const char *>(bytes), sizeof(bytes)));
+                        }
+
+                        static bool read_integer(std::istream &in, std::uint64_t &value) {
+                            std::uint8_t bytes[sizeof(value)];
+                            if (!in.read(reinterpret_cast<char *>(bytes), sizeof(bytes))) {
+                                return false;
+                            }
+                            value = 0;
+                            for (std::size_t i = 0; i < sizeof(value); ++i) {
+                                value |= std::uint64_t(bytes[i]) << (8 * i);
+                            }
+                            return true;
+                        }
+
+                        static bool write_points(std::ostream &out, const std::vector<group_value_type> &points) {
+                            std::vector<std::uint8_t> bytes;
+                            return encode_points(points, bytes) &&
+                                   out.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+                        }
+
+                        static bool encode_points(const std::vector<group_value_type> &points,
+                                                  std::vector<std::uint8_t> &bytes) {
+                            const std::size_t length = coordinate_length();
+                            bytes.resize(2 * length * points.size());
+                            bool result = true;
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < points.size(); ++i) {
+                                coordinate_type x(points[i].X), y(points[i].Y);
+                                auto write_iter = bytes.begin() + 2 * i * length;
+                                if (x.write(write_iter, length) != nil::marshalling::status_type::success ||
+                                    y.write(write_iter, length) != nil::marshalling::status_type::success) {
+#ifdef MULTICORE
+#pragma omp atomic write
+#endif
+                                    result = false;
+                                }
+                            }
+
+                            return result;
+                        }
+
+                        static bool read_points(std::istream &in, std::size_t size,
+                                                std::vector<group_value_type> &points) {
+                            const std::size_t length = coordinate_length();
+                            std::vector<std::uint8_t> bytes(2 * length * size);
+                            if (!in.read(reinterpret_cast<char *>(bytes.data()), bytes.size())) {
+                                return false;
+                            }
+
+                            const group_value_type zero = group_value_type::zero();
+                            points.resize(size);
+                            bool result = true;
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < size; ++i) {
+                                coordinate_type x, y;
+                                auto read_iter = bytes.cbegin() + 2 * i * length;
+                                bool valid = x.read(read_iter, length) == nil::marshalling::status_type::success &&
+                                             y.read(read_iter, length) == nil::marshalling::status_type::success;
+                                if (valid) {
+                                    // The point at infinity is stored with the coordinates of its representation
+                                    points[i] = (x.value() == zero.X && y.value() == zero.Y) ?
+                                                    zero :
+                                                    group_value_type(x.value(), y.value());
+                                    valid = points[i].is_well_formed();
+                                }
+                                if (!valid) {
+#ifdef MULTICORE
+#pragma omp atomic write
+#endif
+                                    result = false;
+                                }
+                            }
+
+                            return result;
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_LAGRANGE_BASES_CACHE_HPP
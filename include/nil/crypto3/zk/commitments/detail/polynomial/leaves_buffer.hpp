@@ -0,0 +1,111 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_DETAIL_LEAVES_BUFFER_HPP
+#define CRYPTO3_ZK_COMMITMENTS_DETAIL_LEAVES_BUFFER_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/range/iterator_range.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+
+                    /**
+                     * @brief Serialized leaves of a FRI Merkle tree stored back to back in one allocation.
+                     *
+                     * Every leaf has the same size, so leaf i starts at i * leaf_size(). The buffer keeps its
+                     * capacity between commitments, which lets a prover reuse one arena for all the tables it
+                     * commits instead of allocating a vector per leaf each time.
+                     */
+                    class leaves_buffer {
+                    public:
+                        typedef std::uint8_t value_type;
+                        typedef boost::iterator_range<const value_type *> leaf_type;
+
+                        leaves_buffer() : _leaves(0), _leaf_size(0) {
+                        }
+
+                        /* Prepares room for leaves_number leaves of leaf_size bytes, reallocating only to grow */
+                        void reset(std::size_t leaves_number, std::size_t leaf_size) {
+                            _leaves = leaves_number;
+                            _leaf_size = leaf_size;
+                            _data.resize(_leaves * _leaf_size);
+                        }
+
+                        /* Frees the memory held by the buffer */
+                        void release() {
+                            std::vector<value_type>().swap(_data);
+                            _ranges.clear();
+                            _ranges.shrink_to_fit();
+                            _leaves = 0;
+                            _leaf_size = 0;
+                        }
+
+                        std::size_t leaves() const {
+                            return _leaves;
+                        }
+
+                        std::size_t leaf_size() const {
+                            return _leaf_size;
+                        }
+
+                        value_type *leaf_data(std::size_t i) {
+                            BOOST_ASSERT(i < _leaves);
+                            return _data.data() + i * _leaf_size;
+                        }
+
+                        leaf_type leaf(std::size_t i) const {
+                            BOOST_ASSERT(i < _leaves);
+                            const value_type *first = _data.data() + i * _leaf_size;
+                            return leaf_type(first, first + _leaf_size);
+                        }
+
+                        /* Views of all the leaves, suitable as input for containers::make_merkle_tree */
+                        const std::vector<leaf_type> &leaves_ranges() {
+                            _ranges.resize(_leaves);
+                            for (std::size_t i = 0; i < _leaves; i++) {
+                                _ranges[i] = leaf(i);
+                            }
+                            return _ranges;
+                        }
+
+                    private:
+                        std::vector<value_type> _data;
+                        std::vector<leaf_type> _ranges;
+                        std::size_t _leaves;
+                        std::size_t _leaf_size;
+                    };
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_DETAIL_LEAVES_BUFFER_HPP
@@ -0,0 +1,166 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+// @file Products of pairings computed with one final exponentiation left to the caller.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_DETAIL_MULTI_PAIR_HPP
+#define CRYPTO3_ZK_COMMITMENTS_DETAIL_MULTI_PAIR_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+
+                    inline std::size_t multi_pair_chunks(std::size_t size) {
+#ifdef MULTICORE
+                        const std::size_t chunks = commitments::detail::multicore_threads();
+#else
+                        const std::size_t chunks = 1;
+#endif
+                        return std::max<std::size_t>(1, std::min(chunks, size));
+                    }
+
+                    /**
+                     * Precomputes a range of G1 elements for the Miller loop.
+                     */
+                    template<typename CurveType, typename InputG1Iterator>
+                    std::vector<typename algebra::pairing::pairing_policy<CurveType>::g1_precomputed_type>
+                        batch_precompute_g1(InputG1Iterator first, InputG1Iterator last) {
+                        const std::size_t size = std::distance(first, last);
+                        std::vector<typename algebra::pairing::pairing_policy<CurveType>::g1_precomputed_type> result(
+                            size);
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t i = 0; i < size; i++) {
+                            result[i] = algebra::precompute_g1<CurveType>(first[i]);
+                        }
+
+                        return result;
+                    }
+
+                    /**
+                     * Precomputes the line coefficients of a range of G2 elements for the Miller loop.
+                     */
+                    template<typename CurveType, typename InputG2Iterator>
+                    std::vector<typename algebra::pairing::pairing_policy<CurveType>::g2_precomputed_type>
+                        batch_precompute_g2(InputG2Iterator first, InputG2Iterator last) {
+                        const std::size_t size = std::distance(first, last);
+                        std::vector<typename algebra::pairing::pairing_policy<CurveType>::g2_precomputed_type> result(
+                            size);
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t i = 0; i < size; i++) {
+                            result[i] = algebra::precompute_g2<CurveType>(first[i]);
+                        }
+
+                        return result;
+                    }
+
+                    /**
+                     * Miller loop output of prod_i e(a_i, b_i) over precomputed elements. The pairs are
+                     * split into chunks processed in parallel, inside a chunk the Miller loops of two pairs
+                     * share one squaring chain. The result still has to go through the final exponentiation.
+                     */
+                    template<typename CurveType>
+                    typename CurveType::gt_type::value_type multi_miller_loop(
+                        const std::vector<typename algebra::pairing::pairing_policy<CurveType>::g1_precomputed_type>
+                            &a,
+                        const std::vector<typename algebra::pairing::pairing_policy<CurveType>::g2_precomputed_type>
+                            &b) {
+                        typedef typename CurveType::gt_type::value_type gt_value_type;
+
+                        BOOST_ASSERT(a.size() == b.size());
+
+                        const std::size_t size = a.size();
+                        // a chunk takes the pairs two by two
+                        const std::size_t chunks = multi_pair_chunks((size + 1) / 2);
+                        const std::size_t chunk_size = ((size + 1) / 2 + chunks - 1) / chunks * 2;
+
+                        std::vector<gt_value_type> partial(chunks, gt_value_type::one());
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+                            const std::size_t first = chunk * chunk_size;
+                            const std::size_t last = std::min(size, first + chunk_size);
+
+                            std::size_t i = first;
+                            for (; i + 1 < last; i += 2) {
+                                partial[chunk] = partial[chunk] *
+                                                 algebra::double_miller_loop<CurveType>(a[i], b[i], a[i + 1], b[i + 1]);
+                            }
+                            if (i < last) {
+                                partial[chunk] = partial[chunk] * algebra::miller_loop<CurveType>(a[i], b[i]);
+                            }
+                        }
+
+                        gt_value_type result = gt_value_type::one();
+                        for (const gt_value_type &p : partial) {
+                            result = result * p;
+                        }
+
+                        return result;
+                    }
+
+                    /**
+                     * Miller loop output of prod_i e(a_i, b_i), same as multiplying algebra::pair results.
+                     */
+                    template<typename CurveType, typename InputG1Iterator, typename InputG2Iterator>
+                    typename CurveType::gt_type::value_type multi_pair(InputG1Iterator a_first,
+                                                                       InputG1Iterator a_last,
+                                                                       InputG2Iterator b_first,
+                                                                       InputG2Iterator b_last) {
+                        BOOST_ASSERT(std::distance(a_first, a_last) == std::distance(b_first, b_last));
+
+                        return multi_miller_loop<CurveType>(batch_precompute_g1<CurveType>(a_first, a_last),
+                                                            batch_precompute_g2<CurveType>(b_first, b_last));
+                    }
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_DETAIL_MULTI_PAIR_HPP
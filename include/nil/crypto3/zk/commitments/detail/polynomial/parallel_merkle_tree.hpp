@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_DETAIL_PARALLEL_MERKLE_TREE_HPP
+#define CRYPTO3_ZK_COMMITMENTS_DETAIL_PARALLEL_MERKLE_TREE_HPP
+
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+
+                    /**
+                     * @brief Builds the same tree as containers::make_merkle_tree, one level at a time.
+                     *
+                     * The leaves are hashed first, then every level of nodes is hashed from the previous one.
+                     * The hashes of a level do not depend on each other, so under MULTICORE each level is split
+                     * across the threads. Nodes are appended in the order of make_merkle_tree, so the roots and
+                     * the proofs are identical to the serial ones.
+                     */
+                    template<typename Hash, std::size_t Arity, typename LeafIterator>
+                    containers::merkle_tree<Hash, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
+                        typedef typename Hash::digest_type digest_type;
+
+                        const std::size_t leaves_number = std::distance(first, last);
+                        containers::merkle_tree<Hash, Arity> tree(leaves_number);
+
+                        std::vector<digest_type> level(leaves_number);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(multicore_threads())
+#endif
+                        for (std::size_t i = 0; i < leaves_number; i++) {
+                            level[i] = crypto3::hash<Hash>(*std::next(first, i));
+                        }
+
+                        std::vector<digest_type> next_level;
+                        while (true) {
+                            for (const digest_type &node : level) {
+                                tree.emplace_back(node);
+                            }
+                            if (level.size() <= 1) {
+                                break;
+                            }
+
+                            BOOST_ASSERT(level.size() % Arity == 0);
+                            next_level.resize(level.size() / Arity);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < next_level.size(); i++) {
+                                next_level[i] = containers::detail::generate_hash<Hash>(
+                                    level.begin() + i * Arity, level.begin() + (i + 1) * Arity);
+                            }
+                            level.swap(next_level);
+                        }
+
+                        return tree;
+                    }
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_DETAIL_PARALLEL_MERKLE_TREE_HPP
@@ -25,15 +25,60 @@
 #ifndef CRYPTO3_ZK_POWERS_OF_TAU_ACCUMULATOR_HPP
 #define CRYPTO3_ZK_POWERS_OF_TAU_ACCUMULATOR_HPP
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 #include <nil/crypto3/zk/commitments/detail/polynomial/powers_of_tau/private_key.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace commitments {
                 namespace detail {
+                    /**
+                     * Multiplies bases[i] by coeff * tau^(first_power + i). The range is split into chunks
+                     * processed in parallel, each chunk computes its first power with one exponentiation
+                     * and the following ones with one multiplication each.
+                     */
+                    template<typename FieldValueType, typename PointIterator>
+                    void powers_of_tau_batch_exp(PointIterator bases_first,
+                                                 PointIterator bases_last,
+                                                 const FieldValueType &coeff,
+                                                 const FieldValueType &tau,
+                                                 std::size_t first_power) {
+                        const std::size_t size = std::distance(bases_first, bases_last);
+#ifdef MULTICORE
+                        const std::size_t threads = commitments::detail::multicore_threads();
+#else
+                        const std::size_t threads = 1;
+#endif
+                        const std::size_t chunks = std::max<std::size_t>(1, std::min(threads, size));
+                        const std::size_t chunk_size = (size + chunks - 1) / chunks;
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+                            const std::size_t first = chunk * chunk_size;
+                            const std::size_t last = std::min(size, first + chunk_size);
+                            if (first >= last) {
+                                continue;
+                            }
+
+                            FieldValueType power = coeff * tau.pow(first_power + first);
+                            for (std::size_t i = first; i < last; i++) {
+                                bases_first[i] = power * bases_first[i];
+                                power *= tau;
+                            }
+                        }
+                    }
+
                     template<typename CurveType, unsigned TauPowersLength>
                     struct powers_of_tau_accumulator {
                         typedef CurveType curve_type;
@@ -86,72 +131,17 @@ namespace nil {
                         }
 
                         void transform(const private_key_type &key) {
-                            std::vector<field_value_type> taupowers;
-
-                            // Construct exponents
-                            // This could be parallelized
-                            auto acc = field_value_type::one();
-                            for (std::size_t i = 0; i < tau_powers_g1_length; ++i) {
-                                // taupowers[i] = tau^i
-                                taupowers.emplace_back(acc);
-                                acc *= key.tau;
-                            }
-
-                            // naive exp, could be parallelized
-                            naive_batch_exp(
-                                tau_powers_g1.begin(), tau_powers_g1.end(), taupowers.begin(), taupowers.end());
+                            const field_value_type one = field_value_type::one();
 
-                            naive_batch_exp(
-                                tau_powers_g2.begin(), tau_powers_g2.end(), taupowers.begin(), taupowers.end());
-
-                            naive_batch_exp_with_coeff(alpha_tau_powers_g1.begin(),
-                                                       alpha_tau_powers_g1.end(),
-                                                       taupowers.begin(),
-                                                       taupowers.end(),
-                                                       key.alpha);
-
-                            naive_batch_exp_with_coeff(beta_tau_powers_g1.begin(),
-                                                       beta_tau_powers_g1.end(),
-                                                       taupowers.begin(),
-                                                       taupowers.end(),
-                                                       key.beta);
+                            powers_of_tau_batch_exp(tau_powers_g1.begin(), tau_powers_g1.end(), one, key.tau, 0);
+                            powers_of_tau_batch_exp(tau_powers_g2.begin(), tau_powers_g2.end(), one, key.tau, 0);
+                            powers_of_tau_batch_exp(
+                                alpha_tau_powers_g1.begin(), alpha_tau_powers_g1.end(), key.alpha, key.tau, 0);
+                            powers_of_tau_batch_exp(
+                                beta_tau_powers_g1.begin(), beta_tau_powers_g1.end(), key.beta, key.tau, 0);
 
                             beta_g2 = beta_g2 * key.beta;
                         }
-
-                    private:
-                        template<typename PointIterator, typename ScalarIterator>
-                        void naive_batch_exp(const PointIterator &bases_begin,
-                                             const PointIterator &bases_end,
-                                             const ScalarIterator &pow_begin,
-                                             const ScalarIterator &pow_end) {
-                            BOOST_ASSERT(std::distance(bases_begin, bases_end) <= std::distance(pow_begin, pow_end));
-
-                            auto base_iter = bases_begin;
-                            auto pow_iter = pow_begin;
-                            while (base_iter < bases_end) {
-                                *base_iter = *pow_iter * *base_iter;
-                                ++base_iter;
-                                ++pow_iter;
-                            }
-                        }
-
-                        template<typename PointIterator, typename ScalarIterator>
-                        void naive_batch_exp_with_coeff(const PointIterator &bases_begin,
-                                                        const PointIterator &bases_end,
-                                                        const ScalarIterator &pow_begin,
-                                                        const ScalarIterator &pow_end,
-                                                        const field_value_type &coeff) {
-                            BOOST_ASSERT(std::distance(bases_begin, bases_end) <= std::distance(pow_begin, pow_end));
-
-                            auto base_iter = bases_begin;
-                            auto pow_iter = pow_begin;
-                            while (base_iter < bases_end) {
-                                *base_iter = (coeff * *pow_iter) * *base_iter;
-                                ++base_iter;
-                                ++pow_iter;
-                            }
-                        }
                     };
 
                 }    // namespace detail
@@ -0,0 +1,347 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_POWERS_OF_TAU_STREAM_ACCUMULATOR_HPP
+#define CRYPTO3_ZK_POWERS_OF_TAU_STREAM_ACCUMULATOR_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/crypto3/marshalling/zk/types/commitments/powers_of_tau/accumulator.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/blake2b.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/polynomial/powers_of_tau/accumulator.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/powers_of_tau/private_key.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+                    /**
+                     * Powers of tau accumulator kept in a stream instead of memory, for ceremonies too large
+                     * to hold all the powers at once. The ceremony size is a runtime parameter.
+                     *
+                     * The stream holds the little-endian fill_powers_of_tau_accumulator encoding of
+                     * powers_of_tau_accumulator: the size-prefixed tau_powers_g1, tau_powers_g2,
+                     * alpha_tau_powers_g1 and beta_tau_powers_g1 lists followed by beta_g2. It is byte for byte
+                     * what powers_of_tau::serialize_accumulator produces, so the transcript of a streamed
+                     * contribution is the one powers_of_tau::compute_transcript gives for the same accumulator.
+                     * A contribution reads the stream chunk by chunk, scales every chunk in parallel and writes
+                     * it to the output stream, so at most chunk_size points are in memory.
+                     */
+                    template<typename CurveType>
+                    struct powers_of_tau_stream_accumulator {
+                        typedef CurveType curve_type;
+                        using g1_type = typename CurveType::template g1_type<>;
+                        using g2_type = typename CurveType::template g2_type<>;
+                        using g1_value_type = typename g1_type::value_type;
+                        using g2_value_type = typename g2_type::value_type;
+                        using field_value_type = typename curve_type::scalar_field_type::value_type;
+                        using private_key_type = powers_of_tau_private_key<curve_type>;
+                        using transcript_hash_type = hashes::blake2b<512>;
+
+                        using endianness = nil::marshalling::option::little_endian;
+                        using field_base_type = nil::marshalling::field_type<endianness>;
+                        // The sections and their point encodings are taken from the accumulator marshalling,
+                        // its layout does not depend on the number of powers
+                        using accumulator_marshalling_type = typename std::decay<
+                            decltype(nil::crypto3::marshalling::types::fill_powers_of_tau_accumulator<
+                                     powers_of_tau_accumulator<CurveType, 1>, endianness>(
+                                std::declval<const powers_of_tau_accumulator<CurveType, 1> &>()))>::type;
+                        template<std::size_t Index>
+                        using section_type =
+                            typename std::tuple_element<Index, typename accumulator_marshalling_type::value_type>::type;
+                        template<typename GroupType>
+                        using element_type = typename std::conditional<
+                            std::is_same<GroupType, g1_type>::value, typename section_type<0>::value_type::value_type,
+                            typename section_type<1>::value_type::value_type>::type;
+                        // Size prefix of the point lists
+                        using length_type = nil::marshalling::types::integral<field_base_type, std::size_t>;
+
+                        // The maximum number of multiplication gates supported
+                        std::size_t tau_powers_length;
+                        // The number of points read, scaled and written at once
+                        std::size_t chunk_size;
+
+                        powers_of_tau_stream_accumulator(std::size_t tau_powers_length,
+                                                         std::size_t chunk_size = 1 << 16) :
+                            tau_powers_length(tau_powers_length),
+                            chunk_size(chunk_size) {
+                            BOOST_ASSERT(tau_powers_length > 0);
+                            BOOST_ASSERT(chunk_size > 0);
+                        }
+
+                        std::size_t tau_powers_g1_length() const {
+                            return (tau_powers_length << 1) - 1;
+                        }
+
+                        /**
+                         * Writes the accumulator before the first contribution: all the powers are generators.
+                         */
+                        bool generate(std::ostream &out) const {
+                            return fill<g1_type>(out, tau_powers_g1_length(), true) &&
+                                   fill<g2_type>(out, tau_powers_length, true) &&
+                                   fill<g1_type>(out, tau_powers_length, true) &&
+                                   fill<g1_type>(out, tau_powers_length, true) && fill<g2_type>(out, 1, false);
+                        }
+
+                        /**
+                         * Reads the accumulator from in, applies the contribution of key and writes the result
+                         * to out. Returns the blake2b-512 hash of the read accumulator, which is the transcript
+                         * the public key of the contribution is bound to and equals powers_of_tau::compute_transcript,
+                         * or an empty vector if in is too short or malformed.
+                         */
+                        std::vector<std::uint8_t> transform(std::istream &in,
+                                                            std::ostream &out,
+                                                            const private_key_type &key) const {
+                            const field_value_type one = field_value_type::one();
+                            accumulator_set<transcript_hash_type> transcript_acc;
+
+                            bool result =
+                                transform_section<g1_type>(in, out, tau_powers_g1_length(), true, one, key.tau,
+                                                           transcript_acc) &&
+                                transform_section<g2_type>(in, out, tau_powers_length, true, one, key.tau,
+                                                           transcript_acc) &&
+                                transform_section<g1_type>(in, out, tau_powers_length, true, key.alpha, key.tau,
+                                                           transcript_acc) &&
+                                transform_section<g1_type>(in, out, tau_powers_length, true, key.beta, key.tau,
+                                                           transcript_acc) &&
+                                // beta_g2 is scaled by beta only, tau^0 = 1
+                                transform_section<g2_type>(in, out, 1, false, key.beta, key.tau, transcript_acc);
+                            if (!result) {
+                                return {};
+                            }
+
+                            typename transcript_hash_type::digest_type digest =
+                                accumulators::extract::hash<transcript_hash_type>(transcript_acc);
+                            return std::vector<std::uint8_t>(digest.begin(), digest.end());
+                        }
+
+                        template<unsigned TauPowersLength>
+                        bool write(std::ostream &out,
+                                   const powers_of_tau_accumulator<CurveType, TauPowersLength> &acc) const {
+                            BOOST_ASSERT(TauPowersLength == tau_powers_length);
+
+                            auto filled_acc =
+                                nil::crypto3::marshalling::types::fill_powers_of_tau_accumulator<
+                                    powers_of_tau_accumulator<CurveType, TauPowersLength>, endianness>(acc);
+                            std::vector<std::uint8_t> bytes(filled_acc.length());
+                            auto write_iter = bytes.begin();
+                            if (filled_acc.write(write_iter, bytes.size()) != nil::marshalling::status_type::success) {
+                                return false;
+                            }
+                            return static_cast<bool>(
+                                out.write(reinterpret_cast<const char *>(bytes.data()), bytes.size()));
+                        }
+
+                        template<unsigned TauPowersLength>
+                        bool read(std::istream &in, powers_of_tau_accumulator<CurveType, TauPowersLength> &acc) const {
+                            BOOST_ASSERT(TauPowersLength == tau_powers_length);
+
+                            std::vector<g2_value_type> beta_g2;
+                            bool result =
+                                read_elements<g1_type>(in, tau_powers_g1_length(), true, acc.tau_powers_g1) &&
+                                read_elements<g2_type>(in, tau_powers_length, true, acc.tau_powers_g2) &&
+                                read_elements<g1_type>(in, tau_powers_length, true, acc.alpha_tau_powers_g1) &&
+                                read_elements<g1_type>(in, tau_powers_length, true, acc.beta_tau_powers_g1) &&
+                                read_elements<g2_type>(in, 1, false, beta_g2);
+                            if (result) {
+                                acc.beta_g2 = beta_g2.front();
+                            }
+                            return result;
+                        }
+
+                    private:
+                        template<typename GroupType>
+                        static std::size_t element_length() {
+                            return element_type<GroupType>(GroupType::value_type::one()).length();
+                        }
+
+                        static std::vector<std::uint8_t> encode_length(std::size_t size) {
+                            length_type length(size);
+                            std::vector<std::uint8_t> bytes(length.length());
+                            auto write_iter = bytes.begin();
+                            length.write(write_iter, bytes.size());
+                            return bytes;
+                        }
+
+                        // Reads the size prefix of a point list and checks it against the expected size
+                        static bool read_length(std::istream &in, std::size_t size, std::vector<std::uint8_t> &bytes) {
+                            bytes = encode_length(size);
+                            std::vector<std::uint8_t> read_bytes(bytes.size());
+                            return in.read(reinterpret_cast<char *>(read_bytes.data()), read_bytes.size()) &&
+                                   read_bytes == bytes;
+                        }
+
+                        template<typename GroupType>
+                        bool transform_section(std::istream &in,
+                                               std::ostream &out,
+                                               std::size_t size,
+                                               bool is_list,
+                                               const field_value_type &coeff,
+                                               const field_value_type &tau,
+                                               accumulator_set<transcript_hash_type> &transcript_acc) const {
+                            std::vector<std::uint8_t> bytes;
+                            std::vector<typename GroupType::value_type> chunk;
+
+                            if (is_list) {
+                                if (!read_length(in, size, bytes)) {
+                                    return false;
+                                }
+                                hash<transcript_hash_type>(bytes, transcript_acc);
+                                if (!out.write(reinterpret_cast<const char *>(bytes.data()), bytes.size())) {
+                                    return false;
+                                }
+                            }
+
+                            for (std::size_t first = 0; first < size; first += chunk_size) {
+                                const std::size_t count = std::min(chunk_size, size - first);
+
+                                bytes.resize(count * element_length<GroupType>());
+                                if (!in.read(reinterpret_cast<char *>(bytes.data()), bytes.size())) {
+                                    return false;
+                                }
+                                hash<transcript_hash_type>(bytes, transcript_acc);
+
+                                if (!decode<GroupType>(bytes, count, chunk)) {
+                                    return false;
+                                }
+                                powers_of_tau_batch_exp(chunk.begin(), chunk.end(), coeff, tau, first);
+                                if (!write_elements<GroupType>(out, chunk)) {
+                                    return false;
+                                }
+                            }
+
+                            return true;
+                        }
+
+                        template<typename GroupType>
+                        bool fill(std::ostream &out, std::size_t size, bool is_list) const {
+                            if (is_list) {
+                                const std::vector<std::uint8_t> bytes = encode_length(size);
+                                if (!out.write(reinterpret_cast<const char *>(bytes.data()), bytes.size())) {
+                                    return false;
+                                }
+                            }
+                            for (std::size_t first = 0; first < size; first += chunk_size) {
+                                const std::size_t count = std::min(chunk_size, size - first);
+                                if (!write_elements<GroupType>(
+                                        out, std::vector<typename GroupType::value_type>(
+                                                 count, GroupType::value_type::one()))) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+
+                        template<typename GroupType>
+                        static bool decode(const std::vector<std::uint8_t> &bytes,
+                                           std::size_t count,
+                                           std::vector<typename GroupType::value_type> &elements) {
+                            const std::size_t length = element_length<GroupType>();
+                            elements.resize(count);
+                            bool result = true;
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < count; i++) {
+                                element_type<GroupType> element;
+                                auto read_iter = bytes.begin() + i * length;
+                                if (element.read(read_iter, length) != nil::marshalling::status_type::success) {
+#ifdef MULTICORE
+#pragma omp atomic write
+#endif
+                                    result = false;
+                                } else {
+                                    elements[i] = element.value();
+                                }
+                            }
+
+                            return result;
+                        }
+
+                        template<typename GroupType>
+                        static bool write_elements(std::ostream &out,
+                                                   const std::vector<typename GroupType::value_type> &elements) {
+                            const std::size_t length = element_length<GroupType>();
+                            std::vector<std::uint8_t> bytes(elements.size() * length);
+                            bool result = true;
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < elements.size(); i++) {
+                                element_type<GroupType> element(elements[i]);
+                                auto write_iter = bytes.begin() + i * length;
+                                if (element.write(write_iter, length) != nil::marshalling::status_type::success) {
+#ifdef MULTICORE
+#pragma omp atomic write
+#endif
+                                    result = false;
+                                }
+                            }
+
+                            return result && out.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+                        }
+
+                        template<typename GroupType>
+                        bool read_elements(std::istream &in,
+                                           std::size_t size,
+                                           bool is_list,
+                                           std::vector<typename GroupType::value_type> &elements) const {
+                            std::vector<std::uint8_t> bytes;
+                            if (is_list && !read_length(in, size, bytes)) {
+                                return false;
+                            }
+                            bytes.resize(size * element_length<GroupType>());
+                            if (!in.read(reinterpret_cast<char *>(bytes.data()), bytes.size())) {
+                                return false;
+                            }
+                            return decode<GroupType>(bytes, size, elements);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_POWERS_OF_TAU_STREAM_ACCUMULATOR_HPP
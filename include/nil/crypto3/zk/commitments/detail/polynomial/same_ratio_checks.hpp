@@ -0,0 +1,116 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_SAME_RATIO_CHECKS_HPP
+#define CRYPTO3_ZK_SAME_RATIO_CHECKS_HPP
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/random/random_device.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/polynomial/multi_pair.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+                    /**
+                     * Collects checks of the form e(a, d) == e(b, c) for ((a, b), (c, d)), i.e. (a, b) and
+                     * (c, d) have the same ratio, and verifies all of them at once.
+                     *
+                     * Every check is scaled by a random non-zero r and moved to one side:
+                     * e(r * a, d) * e(-r * b, c) == 1. The product of all scaled checks is one with
+                     * negligible probability unless every check holds. G1 terms paired with the same G2
+                     * element are added up, so the whole set costs one multi-pairing over the distinct G2
+                     * elements and a single final exponentiation.
+                     */
+                    template<typename CurveType, typename RNG = boost::random_device>
+                    class same_ratio_checks {
+                        typedef CurveType curve_type;
+                        using scalar_field_type = typename curve_type::scalar_field_type;
+                        using scalar_field_value_type = typename scalar_field_type::value_type;
+                        using g1_value_type = typename CurveType::template g1_type<>::value_type;
+                        using g2_value_type = typename CurveType::template g2_type<>::value_type;
+                        using gt_value_type = typename CurveType::gt_type::value_type;
+
+                    public:
+                        same_ratio_checks() : rng() {
+                        }
+
+                        void add(const std::pair<g1_value_type, g1_value_type> &g1_pair,
+                                 const std::pair<g2_value_type, g2_value_type> &g2_pair) {
+                            scalar_field_value_type r = algebra::random_element<scalar_field_type>(rng);
+                            while (r.is_zero()) {
+                                r = algebra::random_element<scalar_field_type>(rng);
+                            }
+
+                            merge(r * g1_pair.first, g2_pair.second);
+                            merge(-(r * g1_pair.second), g2_pair.first);
+                        }
+
+                        bool verify() const {
+                            std::vector<g1_value_type> g1_nonzero;
+                            std::vector<g2_value_type> g2_nonzero;
+                            for (std::size_t i = 0; i < g1.size(); ++i) {
+                                // e(0, Q) = 1
+                                if (!g1[i].is_zero() && !g2[i].is_zero()) {
+                                    g1_nonzero.emplace_back(g1[i]);
+                                    g2_nonzero.emplace_back(g2[i]);
+                                }
+                            }
+
+                            return algebra::final_exponentiation<curve_type>(multi_pair<curve_type>(
+                                       g1_nonzero.begin(), g1_nonzero.end(), g2_nonzero.begin(), g2_nonzero.end())) ==
+                                   gt_value_type::one();
+                        }
+
+                    private:
+                        void merge(const g1_value_type &p, const g2_value_type &q) {
+                            auto it = std::find(g2.begin(), g2.end(), q);
+                            if (it == g2.end()) {
+                                g1.emplace_back(p);
+                                g2.emplace_back(q);
+                            } else {
+                                g1[std::distance(g2.begin(), it)] = g1[std::distance(g2.begin(), it)] + p;
+                            }
+                        }
+
+                        RNG rng;
+                        std::vector<g1_value_type> g1;
+                        std::vector<g2_value_type> g2;
+                    };
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_SAME_RATIO_CHECKS_HPP
@@ -1,10 +1,18 @@
 #ifndef CRYPTO3_ZK_VECTOR_PAIRS_HPP
 #define CRYPTO3_ZK_VECTOR_PAIRS_HPP
 
-#include<vector>
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <vector>
+
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
 
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
@@ -42,21 +50,39 @@ namespace nil {
                             r.emplace_back(algebra::random_element<scalar_field_type>());
                         }
 
-                        typename PointIterator::value_type res1 =
-                            algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
-                                v1_begin,
-                                v1_end,
-                                r.begin(),
-                                r.end(),
-                                1);
+#ifdef MULTICORE
+                        const std::size_t threads = commitments::detail::multicore_threads();
+#else
+                        const std::size_t threads = 1;
+#endif
+                        // Both combinations share the scalars, every chunk of r is used for a part of v1 and
+                        // the same part of v2. The 2 * chunks partial sums are independent.
+                        const std::size_t chunks = std::max<std::size_t>(1, std::min(threads, size));
+                        const std::size_t chunk_size = (size + chunks - 1) / chunks;
+                        std::vector<typename PointIterator::value_type> partial(
+                            2 * chunks, PointIterator::value_type::zero());
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t task = 0; task < 2 * chunks; ++task) {
+                            const std::size_t first = (task / 2) * chunk_size;
+                            const std::size_t last = std::min(size, first + chunk_size);
+                            if (first >= last) {
+                                continue;
+                            }
 
-                        typename PointIterator::value_type res2 =
-                                algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
-                                    v2_begin,
-                                    v2_end,
-                                    r.begin(),
-                                    r.end(),
-                                    1);
+                            const PointIterator &v_begin = task % 2 == 0 ? v1_begin : v2_begin;
+                            partial[task] = algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
+                                v_begin + first, v_begin + last, r.begin() + first, r.begin() + last, 1);
+                        }
+
+                        typename PointIterator::value_type res1 = PointIterator::value_type::zero();
+                        typename PointIterator::value_type res2 = PointIterator::value_type::zero();
+                        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                            res1 = res1 + partial[2 * chunk];
+                            res2 = res2 + partial[2 * chunk + 1];
+                        }
 
                         return std::make_pair(res1, res2);
                     }
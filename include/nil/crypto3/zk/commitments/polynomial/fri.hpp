@@ -65,20 +65,23 @@ namespace nil {
                          typename TranscriptHashType,
                          std::size_t M,
                          std::size_t BatchedSize = 0,
-                         bool IsConstSize = (bool)BatchedSize>
+                         bool IsConstSize = (bool)BatchedSize,
+                         typename TranscriptType = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>>
                 struct fri : public detail::basic_batched_fri<FieldType,
                                                               MerkleTreeHashType,
                                                               TranscriptHashType,
                                                               M,
                                                               BatchedSize,
-                                                              IsConstSize> {
+                                                              IsConstSize,
+                                                              TranscriptType> {
 
                     using basic_fri = detail::basic_batched_fri<FieldType,
                                                                 MerkleTreeHashType,
                                                                 TranscriptHashType,
                                                                 M,
                                                                 BatchedSize,
-                                                                IsConstSize>;
+                                                                IsConstSize,
+                                                                TranscriptType>;
                     constexpr static const std::size_t m = basic_fri::m;
                     constexpr static const std::size_t leaf_size = basic_fri::leaf_size;
                     constexpr static const bool is_const_size = IsConstSize;
@@ -106,7 +109,8 @@ namespace nil {
                                                                                   typename FRI::transcript_hash_type,
                                                                                   FRI::m,
                                                                                   FRI::leaf_size,
-                                                                                  FRI::is_const_size>,
+                                                                                  FRI::is_const_size,
+                                                                                  typename FRI::transcript_type>,
                                                                  FRI>::value,
                                                  bool>::type = true>
                 static typename FRI::basic_fri::proof_type proof_eval(
@@ -124,7 +128,8 @@ namespace nil {
                                                                                   typename FRI::transcript_hash_type,
                                                                                   FRI::m,
                                                                                   FRI::leaf_size,
-                                                                                  FRI::is_const_size>,
+                                                                                  FRI::is_const_size,
+                                                                                  typename FRI::transcript_type>,
                                                                  FRI>::value,
                                                  bool>::type = true>
                 static typename FRI::basic_fri::proof_type proof_eval(
@@ -143,7 +148,8 @@ namespace nil {
                                                                                     typename FRI::transcript_hash_type,
                                                                                     FRI::m,
                                                                                     FRI::leaf_size,
-                                                                                    FRI::is_const_size>,
+                                                                                    FRI::is_const_size,
+                                                                                    typename FRI::transcript_type>,
                                              FRI>::value,
                              bool>::type = true>
                 static bool verify_eval(
@@ -26,9 +26,16 @@
 #ifndef CRYPTO3_ZK_KIMCHI_PEDERSEN_COMMITMENT_SCHEME_HPP
 #define CRYPTO3_ZK_KIMCHI_PEDERSEN_COMMITMENT_SCHEME_HPP
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
+#include <chrono>
+#include <istream>
+#include <ostream>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
@@ -38,9 +45,12 @@
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 #include <nil/crypto3/algebra/multiexp/inner_product.hpp>
 
+#include <nil/crypto3/zk/commitments/detail/polynomial/group_fft.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/lagrange_bases_cache.hpp>
 #include <nil/crypto3/zk/transcript/kimchi_transcript.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/detail/mapping.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/detail/kimchi_functions.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -95,10 +105,22 @@ namespace nil {
                                 return;
                             }
 
-                            // std::vector<typename group_type::value_type> lg(g.begin(), g.begin() + n);
-                            lagrange_bases[n] = std::vector<typename group_type::value_type>(g.begin(), g.begin() + n);
+                            std::vector<typename group_type::value_type> basis(g.begin(), g.begin() + n);
+                            detail::group_inverse_fft(basis, domain.omega);
+                            lagrange_bases[n] = std::move(basis);
+                        }
+
+                        // Lagrange bases are computed once and then loaded from a cache, see
+                        // detail::lagrange_bases_cache for the format. A cache is only loaded into the params
+                        // of the SRS it was saved from.
+                        bool save_lagrange_bases(std::ostream &out) const {
+                            typedef detail::lagrange_bases_cache<group_type> cache_type;
+                            return cache_type::write(out, cache_type::srs_digest(g, h), lagrange_bases);
+                        }
 
-                            domain.inverse_fft(lagrange_bases[n]);
+                        bool load_lagrange_bases(std::istream &in) {
+                            typedef detail::lagrange_bases_cache<group_type> cache_type;
+                            return cache_type::read(in, cache_type::srs_digest(g, h), lagrange_bases, g.size());
                         }
                     };
 
@@ -628,113 +650,227 @@ namespace nil {
                         return s;
                     }
 
-                    static bool verify_eval(params_type &params, group_map_type &group_map,
-                                            std::vector<batchproof_type> &batches) {
-
-                        std::size_t power_of_two = 1;
-                        for(; power_of_two < params.g.size(); power_of_two <<= 1);
-
-                        std::vector<typename group_type::value_type> points = {params.h};
-                        points.insert(points.end(), params.g.begin(), params.g.end());
-                        points.resize(power_of_two + 1, group_type::value_type::zero());
-
-                        std::vector<typename scalar_field_type::value_type> scalars(power_of_two + 1, scalar_field_type::value_type::zero());                        
-
-                        typename scalar_field_type::value_type rand_base = algebra::random_element<scalar_field_type>();
-                        typename scalar_field_type::value_type sg_rand_base = algebra::random_element<scalar_field_type>();
-                        typename scalar_field_type::value_type rand_base_i = scalar_field_type::value_type::one();
-                        typename scalar_field_type::value_type sg_rand_base_i = scalar_field_type::value_type::one();
+                    /**
+                     * Verifier of opening proofs collected one by one and checked with a single MSM.
+                     *
+                     * add() runs the sponge of a proof, which is sequential within a proof. verify() lays out
+                     * the scalars and points of all the collected proofs in one pre-sized array, computes the
+                     * b_poly terms of the proofs in parallel and checks everything with one parallel MSM.
+                     * A verifier node keeps adding proofs until ready() reports its size or latency threshold.
+                     */
+                    class batch_verifier {
+                        typedef typename scalar_field_type::value_type scalar_value_type;
+                        typedef typename group_type::value_type group_value_type;
+
+                    public:
+                        typedef std::chrono::steady_clock clock_type;
+
+                        batch_verifier(params_type &params, group_map_type &group_map) :
+                            params(params), group_map(group_map),
+                            rand_base(algebra::random_element<scalar_field_type>()),
+                            sg_rand_base(algebra::random_element<scalar_field_type>()),
+                            rand_base_i(scalar_value_type::one()), sg_rand_base_i(scalar_value_type::one()) {
+                        }
 
-                        for(auto &batch : batches){
+                        void add(batchproof_type batch) {
                             std::vector<std::tuple<evaluation_type, int>> es;
-                            for (auto eval : batch.evaluation) {
-                                int bnd = -1;
-                                if (!eval.commit.shifted.is_zero()) {
-                                    bnd = eval.bound;
-                                }
-                                es.emplace_back(eval, bnd);
+                            for (const auto &eval : batch.evaluation) {
+                                es.emplace_back(eval, eval.commit.shifted.is_zero() ? -1 : eval.bound);
                             }
 
-                            typename scalar_field_type::value_type combined_inner_product0 =
-                                combined_inner_product(batch.evaluation_points, batch.xi, batch.r, es, params.g.size());
-                            
+                            const scalar_value_type combined_inner_product0 = combined_inner_product(
+                                batch.evaluation_points, batch.xi, batch.r, es, params.g.size());
+
                             batch.sponge.absorb_fr(functions::shift_scalar(combined_inner_product0));
                             typename base_field_type::value_type t = batch.sponge.challenge_fq();
-                            typename group_type::value_type u = group_map.to_group(t);
-                            const auto &[chals, chal_invs] = batch.opening.challenges(params.endo_r, batch.sponge);
+                            group_value_type u = group_map.to_group(t);
+                            auto [chals, chal_invs] = batch.opening.challenges(params.endo_r, batch.sponge);
                             batch.sponge.absorb_g(batch.opening.delta);
 
-                            typename scalar_field_type::value_type c = batch.sponge.squeeze_challenge(params.endo_r);    // to field using endo_r
+                            scalar_value_type c = batch.sponge.squeeze_challenge(params.endo_r);    // to field using endo_r
 
-                            typename scalar_field_type::value_type scale = scalar_field_type::value_type::one();
-                            typename scalar_field_type::value_type b0 = scalar_field_type::value_type::zero();
-
-                            for (auto e : batch.evaluation_points) {
-                                typename scalar_field_type::value_type term = b_poly(chals, e);
-                                b0 += scale * term;
-                                scale *= batch.r;
+                            if (pending.empty()) {
+                                first_added = clock_type::now();
                             }
+                            pending.push_back(pending_proof {std::move(batch), std::move(chals), std::move(chal_invs),
+                                                             c, combined_inner_product0, u, rand_base_i,
+                                                             sg_rand_base_i});
 
-                            std::vector<typename scalar_field_type::value_type> s = b_poly_coefficents(chals);
+                            rand_base_i *= rand_base;
+                            sg_rand_base_i *= sg_rand_base;
+                        }
 
-                            auto neg_rand_base_i = -rand_base_i;
+                        std::size_t size() const {
+                            return pending.size();
+                        }
 
-                            points.push_back(batch.opening.sg);
-                            scalars.push_back(neg_rand_base_i * batch.opening.z1 - sg_rand_base_i);
+                        bool ready(std::size_t max_size, clock_type::duration max_latency) const {
+                            return !pending.empty() &&
+                                   (pending.size() >= max_size || clock_type::now() - first_added >= max_latency);
+                        }
 
-                            std::transform(s.begin(), s.end(), s.begin(), [&sg_rand_base_i](auto &iter_s){
-                                return iter_s * sg_rand_base_i;
-                            });
+                        /*!
+                         * @brief Checks all the proofs added since the last call and starts a new batch with fresh
+                         * random bases, so that no two batches share their random challenges.
+                         */
+                        bool verify() {
+                            if (pending.empty()) {
+                                return true;
+                            }
+
+                            std::size_t power_of_two = 1;
+                            for (; power_of_two < params.g.size(); power_of_two <<= 1)
+                                ;
+
+                            const std::size_t n = pending.size();
+                            std::vector<std::size_t> offsets(n + 1, power_of_two + 1);
+                            for (std::size_t i = 0; i < n; ++i) {
+                                offsets[i + 1] = offsets[i] + terms_amount(pending[i].batch);
+                            }
+
+                            std::vector<group_value_type> points(offsets[n], group_value_type::zero());
+                            std::vector<scalar_value_type> scalars(offsets[n], scalar_value_type::zero());
+                            points[0] = params.h;
+                            std::copy(params.g.begin(), params.g.end(), points.begin() + 1);
+
+                            std::vector<std::vector<scalar_value_type>> s(n);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < n; ++i) {
+                                s[i] = fill(pending[i], points.begin() + offsets[i], scalars.begin() + offsets[i]);
+                            }
+
+                            // The coefficients of b_poly of every proof are scalars of the SRS
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t j = 0; j < power_of_two; ++j) {
+                                for (std::size_t i = 0; i < n; ++i) {
+                                    if (j < s[i].size()) {
+                                        scalars[j + 1] += s[i][j];
+                                    }
+                                }
+                            }
+                            for (const pending_proof &proof : pending) {
+                                scalars[0] -= proof.rand_base_i * proof.batch.opening.z2;
+                            }
+
+#ifdef MULTICORE
+                            const std::size_t chunks = commitments::detail::multicore_threads();
+#else
+                            const std::size_t chunks = 1;
+#endif
+                            const bool result = algebra::multiexp_with_mixed_addition<multiexp_method>(
+                                                    points.begin(), points.end(), scalars.begin(), scalars.end(),
+                                                    chunks) == group_value_type::zero();
+
+                            pending.clear();
+                            rand_base = algebra::random_element<scalar_field_type>();
+                            sg_rand_base = algebra::random_element<scalar_field_type>();
+                            rand_base_i = scalar_value_type::one();
+                            sg_rand_base_i = scalar_value_type::one();
+                            return result;
+                        }
 
-                            for (int i = 0; i < s.size(); ++i) {
-                                scalars[i + 1] += s[i];
+                    private:
+                        struct pending_proof {
+                            batchproof_type batch;
+                            std::vector<scalar_value_type> chals;
+                            std::vector<scalar_value_type> chal_invs;
+                            scalar_value_type c;
+                            scalar_value_type combined_inner_product;
+                            group_value_type u;
+                            scalar_value_type rand_base_i;
+                            scalar_value_type sg_rand_base_i;
+                        };
+
+                        // The number of points a proof adds to the MSM besides the SRS
+                        static std::size_t terms_amount(const batchproof_type &batch) {
+                            std::size_t result = 4 + 2 * batch.opening.lr.size();
+                            for (const auto &eval : batch.evaluation) {
+                                result += eval.commit.unshifted.size();
+                                if (eval.bound >= 0 && !eval.commit.shifted.is_zero()) {
+                                    ++result;
+                                }
                             }
-                            
-                            scalars[0] -= rand_base_i * batch.opening.z2;
-                            scalars.push_back(neg_rand_base_i * batch.opening.z1 * b0);
-                            points.push_back(u);
+                            return result;
+                        }
 
-                            auto rand_base_i_c_i = c * rand_base_i;
-                            for (int i = 0; i < batch.opening.lr.size(); ++i) {
-                                const auto [l, r] = batch.opening.lr[i];
-                                points.push_back(l);
-                                scalars.push_back(rand_base_i_c_i * chal_invs[i]);
+                        // Writes the points and scalars of the proof and returns its scaled b_poly coefficients
+                        static std::vector<scalar_value_type>
+                            fill(const pending_proof &proof,
+                                 typename std::vector<group_value_type>::iterator points,
+                                 typename std::vector<scalar_value_type>::iterator scalars) {
+                            const batchproof_type &batch = proof.batch;
+
+                            scalar_value_type scale = scalar_value_type::one();
+                            scalar_value_type b0 = scalar_value_type::zero();
+                            for (const auto &e : batch.evaluation_points) {
+                                b0 += scale * b_poly(proof.chals, e);
+                                scale *= batch.r;
+                            }
 
-                                points.push_back(r);
-                                scalars.push_back(rand_base_i_c_i * chals[i]);
+                            std::vector<scalar_value_type> s = b_poly_coefficents(proof.chals);
+                            for (auto &s_i : s) {
+                                s_i *= proof.sg_rand_base_i;
                             }
 
-                            auto xi_i = scalar_field_type::value_type::one();
-                            for (auto eval : batch.evaluation) {
-                                for (auto comm : eval.commit.unshifted) {
-                                    scalars.push_back(rand_base_i_c_i * xi_i);
-                                    points.push_back(comm);
+                            const scalar_value_type neg_rand_base_i = -proof.rand_base_i;
+                            *points++ = batch.opening.sg;
+                            *scalars++ = neg_rand_base_i * batch.opening.z1 - proof.sg_rand_base_i;
+                            *points++ = proof.u;
+                            *scalars++ = neg_rand_base_i * batch.opening.z1 * b0;
+
+                            const scalar_value_type rand_base_i_c_i = proof.c * proof.rand_base_i;
+                            for (std::size_t i = 0; i < batch.opening.lr.size(); ++i) {
+                                const auto [l, r] = batch.opening.lr[i];
+                                *points++ = l;
+                                *scalars++ = rand_base_i_c_i * proof.chal_invs[i];
+                                *points++ = r;
+                                *scalars++ = rand_base_i_c_i * proof.chals[i];
+                            }
 
+                            scalar_value_type xi_i = scalar_value_type::one();
+                            for (const auto &eval : batch.evaluation) {
+                                for (const auto &comm : eval.commit.unshifted) {
+                                    *points++ = comm;
+                                    *scalars++ = rand_base_i_c_i * xi_i;
                                     xi_i *= batch.xi;
                                 }
 
-                                if (eval.bound >= 0) {
-                                    if (!eval.commit.shifted.is_zero()) {
-                                        scalars.push_back(rand_base_i_c_i * xi_i);
-                                        points.push_back(eval.commit.shifted);
-
-                                        xi_i *= batch.xi;
-                                    }
+                                if (eval.bound >= 0 && !eval.commit.shifted.is_zero()) {
+                                    *points++ = eval.commit.shifted;
+                                    *scalars++ = rand_base_i_c_i * xi_i;
+                                    xi_i *= batch.xi;
                                 }
                             }
 
-                            scalars.push_back(rand_base_i_c_i * combined_inner_product0);
-                            points.push_back(u);
-                            scalars.push_back(rand_base_i);
-                            points.push_back(batch.opening.delta);
+                            *points++ = proof.u;
+                            *scalars++ = rand_base_i_c_i * proof.combined_inner_product;
+                            *points++ = batch.opening.delta;
+                            *scalars++ = proof.rand_base_i;
 
-                            rand_base_i *= rand_base;
-                            sg_rand_base_i *= sg_rand_base;
+                            return s;
                         }
 
-                        return (algebra::multiexp_with_mixed_addition<multiexp_method>(
-                                    points.begin(), points.end(), scalars.begin(), scalars.end(), 1) ==
-                                group_type::value_type::zero());
+                        params_type &params;
+                        group_map_type &group_map;
+                        scalar_value_type rand_base;
+                        scalar_value_type sg_rand_base;
+                        scalar_value_type rand_base_i;
+                        scalar_value_type sg_rand_base_i;
+                        std::vector<pending_proof> pending;
+                        clock_type::time_point first_added;
+                    };
+
+                    static bool verify_eval(params_type &params, group_map_type &group_map,
+                                            std::vector<batchproof_type> &batches) {
+                        batch_verifier verifier(params, group_map);
+                        for (const auto &batch : batches) {
+                            verifier.add(batch);
+                        }
+                        return verifier.verify();
                     }
                 };
             }    // namespace commitments
@@ -35,9 +35,18 @@
   Will probably go away in more general exp refactoring.
 */
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 
 #include <nil/crypto3/zk/commitments/polynomial/knowledge_commitment.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -54,58 +63,94 @@ namespace nil {
                         opt_window_wnaf_exp(base.h, scalar, scalar_bits));
                 }
 
-                template<typename MultiexpMethod, typename T1, typename T2, typename InputFieldIterator>
+                /*!
+                 * @brief Knowledge commitment multiexp over a sparse vector given as the ranges of its sorted
+                 * indices and its values, so that vectors stored outside of knowledge_commitment_vector,
+                 * e.g. in a loaded binary proving key, are usable without a copy.
+                 */
+                template<typename MultiexpMethod, typename T1, typename T2, typename InputIndexIterator,
+                         typename InputValueIterator, typename InputFieldIterator>
                 typename knowledge_commitment<T1, T2>::value_type
-                    kc_multiexp_with_mixed_addition(const knowledge_commitment_vector<T1, T2> &vec,
+                    kc_multiexp_with_mixed_addition(const std::size_t domain_size, InputIndexIterator indices_first,
+                                                    InputIndexIterator indices_last, InputValueIterator values_first,
                                                     const std::size_t min_idx, const std::size_t max_idx,
                                                     InputFieldIterator scalar_start, InputFieldIterator scalar_end,
                                                     const std::size_t chunks) {
                     typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
-                    typedef typename std::iterator_traits<InputFieldIterator>::value_type::field_type field_type;
+                    typedef typename knowledge_commitment<T1, T2>::value_type value_type;
 
                     const size_t scalar_length = std::distance(scalar_start, scalar_end);
-                    assert((size_t)(scalar_length) <= vec.domain_size_);
-
-                    auto index_it = std::lower_bound(vec.indices.begin(), vec.indices.end(), min_idx);
-                    const std::size_t offset = index_it - vec.indices.begin();
-
-                    auto value_it = vec.values.begin() + offset;
+                    assert((size_t)(scalar_length) <= domain_size);
+
+                    const auto index_first = std::lower_bound(indices_first, indices_last, min_idx);
+                    const auto index_last = std::lower_bound(index_first, indices_last, max_idx);
+                    const std::size_t offset = index_first - indices_first;
+                    const std::size_t n = index_last - index_first;
+                    if (n == 0) {
+                        return value_type::zero();
+                    }
 
                     const field_value_type zero = field_value_type::zero();
                     const field_value_type one = field_value_type::one();
 
-                    std::vector<field_value_type> p;
-                    std::vector<typename knowledge_commitment<T1, T2>::value_type> g;
+                    // Zeros are skipped and ones are summed in parallel chunks, only the rest goes through
+                    // the multiexp
+                    const std::size_t parts = std::max(std::size_t(1), std::min(chunks, n));
+                    std::vector<value_type> acc(parts, value_type::zero());
+                    std::vector<std::vector<field_value_type>> p(parts);
+                    std::vector<std::vector<value_type>> g(parts);
 
-                    typename knowledge_commitment<T1, T2>::value_type acc =
-                        knowledge_commitment<T1, T2>::value_type::zero();
-
-                    while (index_it != vec.indices.end() && *index_it < max_idx) {
-                        const std::size_t scalar_position = (*index_it) - min_idx;
-                        assert(scalar_position < scalar_length);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                    for (std::size_t i = 0; i < parts; ++i) {
+                        for (std::size_t j = i * n / parts; j < (i + 1) * n / parts; ++j) {
+                            const std::size_t scalar_position = *(index_first + j) - min_idx;
+                            assert(scalar_position < scalar_length);
 
-                        const field_value_type scalar = *(scalar_start + scalar_position);
+                            const field_value_type scalar = *(scalar_start + scalar_position);
+                            const value_type &value = *(values_first + offset + j);
 
-                        if (scalar == zero) {
-                            // do nothing
-                        } else if (scalar == one) {
+                            if (scalar == zero) {
+                                // do nothing
+                            } else if (scalar == one) {
 #ifdef USE_MIXED_ADDITION
-                            acc.g = acc.g.mixed_add(value_it->g);
-                            acc.h = acc.h.mixed_add(value_it->h);
+                                acc[i].g = acc[i].g.mixed_add(value.g);
+                                acc[i].h = acc[i].h.mixed_add(value.h);
 #else
-                            acc.g = acc.g + value_it->g;
-                            acc.h = acc.h + value_it->h;
+                                acc[i].g = acc[i].g + value.g;
+                                acc[i].h = acc[i].h + value.h;
 #endif
-                        } else {
-                            p.emplace_back(scalar);
-                            g.emplace_back(*value_it);
+                            } else {
+                                p[i].emplace_back(scalar);
+                                g[i].emplace_back(value);
+                            }
                         }
+                    }
 
-                        ++index_it;
-                        ++value_it;
+                    value_type result = value_type::zero();
+                    std::vector<field_value_type> scalars;
+                    std::vector<value_type> bases;
+                    for (std::size_t i = 0; i < parts; ++i) {
+                        result = result + acc[i];
+                        scalars.insert(scalars.end(), p[i].begin(), p[i].end());
+                        bases.insert(bases.end(), g[i].begin(), g[i].end());
                     }
 
-                    return acc + algebra::multiexp<MultiexpMethod>(g.begin(), g.end(), p.begin(), p.end(), chunks);
+                    return result +
+                           algebra::multiexp<MultiexpMethod>(bases.begin(), bases.end(), scalars.begin(),
+                                                             scalars.end(), chunks);
+                }
+
+                template<typename MultiexpMethod, typename T1, typename T2, typename InputFieldIterator>
+                typename knowledge_commitment<T1, T2>::value_type
+                    kc_multiexp_with_mixed_addition(const knowledge_commitment_vector<T1, T2> &vec,
+                                                    const std::size_t min_idx, const std::size_t max_idx,
+                                                    InputFieldIterator scalar_start, InputFieldIterator scalar_end,
+                                                    const std::size_t chunks) {
+                    return kc_multiexp_with_mixed_addition<MultiexpMethod, T1, T2>(
+                        vec.domain_size_, vec.indices.begin(), vec.indices.end(), vec.values.begin(), min_idx,
+                        max_idx, scalar_start, scalar_end, chunks);
                 }
 
                 template<typename T1, typename T2, typename FieldType>
@@ -183,7 +228,7 @@ namespace nil {
                     chunk_pos[num_chunks] = v.size();
 
 #ifdef MULTICORE
-#pragma omp parallel for
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
 #endif
                     for (std::size_t i = 0; i < num_chunks; ++i) {
                         tmp[i] = kc_batch_exp_internal<T1, T2, FieldType>(
@@ -54,6 +54,10 @@
 #ifndef CRYPTO3_ZK_COMMITMENTS_KZG_IPP2_HPP
 #define CRYPTO3_ZK_COMMITMENTS_KZG_IPP2_HPP
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <tuple>
 #include <vector>
 #include <type_traits>
@@ -66,6 +70,9 @@
 
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 
+#include <nil/crypto3/zk/commitments/detail/polynomial/multi_pair.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
@@ -106,14 +113,19 @@ namespace nil {
                         commitment_key<group_type> scale(InputIterator s_first, InputIterator s_last) const {
                             BOOST_ASSERT(has_correct_len(std::distance(s_first, s_last)));
 
+                            const std::size_t size = a.size();
                             commitment_key<group_type> result;
-                            std::for_each(boost::make_zip_iterator(boost::make_tuple(s_first, a.begin(), b.begin())),
-                                          boost::make_zip_iterator(boost::make_tuple(s_last, a.end(), b.end())),
-                                          [&](const boost::tuple<const field_value_type &, const group_value_type &,
-                                                                 const group_value_type &> &t) {
-                                              result.a.emplace_back(t.template get<1>() * t.template get<0>());
-                                              result.b.emplace_back(t.template get<2>() * t.template get<0>());
-                                          });
+                            result.a.resize(size);
+                            result.b.resize(size);
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < size; i++) {
+                                const field_value_type &s_i = *(s_first + i);
+                                result.a[i] = a[i] * s_i;
+                                result.b[i] = b[i] * s_i;
+                            }
 
                             return result;
                         }
@@ -153,18 +165,18 @@ namespace nil {
                             BOOST_ASSERT(b.size() == right.b.size());
                             BOOST_ASSERT(a.size() == b.size());
 
+                            const std::size_t size = a.size();
                             commitment_key<group_type> result;
-
-                            std::for_each(
-                                boost::make_zip_iterator(
-                                    boost::make_tuple(a.begin(), b.begin(), right.a.begin(), right.b.begin())),
-                                boost::make_zip_iterator(
-                                    boost::make_tuple(a.end(), b.end(), right.a.end(), right.b.end())),
-                                [&](const boost::tuple<const group_value_type &, const group_value_type &,
-                                                       const group_value_type &, const group_value_type &> &t) {
-                                    result.a.emplace_back(t.template get<0>() + t.template get<2>() * scale);
-                                    result.b.emplace_back(t.template get<1>() + t.template get<3>() * scale);
-                                });
+                            result.a.resize(size);
+                            result.b.resize(size);
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < size; i++) {
+                                result.a[i] = a[i] + right.a[i] * scale;
+                                result.b[i] = b[i] + right.b[i] * scale;
+                            }
 
                             return result;
                         }
@@ -219,35 +231,21 @@ namespace nil {
                         BOOST_ASSERT(wkey.has_correct_len(std::distance(b_first, b_last)));
                         BOOST_ASSERT(std::distance(a_first, a_last) == std::distance(b_first, b_last));
 
-                        // (A * v)
-                        gt_value_type t1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.a.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.a.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t1 = t1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
+                        // A and B take part in two products each, they are precomputed only once
+                        const auto a_precomp = detail::batch_precompute_g1<curve_type>(a_first, a_last);
+                        const auto b_precomp = detail::batch_precompute_g2<curve_type>(b_first, b_last);
 
+                        // (A * v)
+                        gt_value_type t1 = detail::multi_miller_loop<curve_type>(
+                            a_precomp, detail::batch_precompute_g2<curve_type>(vkey.a.begin(), vkey.a.end()));
                         // (B * v)
-                        gt_value_type t2 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(wkey.a.begin(), b_first)),
-                                      boost::make_zip_iterator(boost::make_tuple(wkey.a.end(), b_last)),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t2 = t2 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.b.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.b.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u1 = u1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u2 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(wkey.b.begin(), b_first)),
-                                      boost::make_zip_iterator(boost::make_tuple(wkey.b.end(), b_last)),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u2 = u2 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
+                        gt_value_type t2 = detail::multi_miller_loop<curve_type>(
+                            detail::batch_precompute_g1<curve_type>(wkey.a.begin(), wkey.a.end()), b_precomp);
+
+                        gt_value_type u1 = detail::multi_miller_loop<curve_type>(
+                            a_precomp, detail::batch_precompute_g2<curve_type>(vkey.b.begin(), vkey.b.end()));
+                        gt_value_type u2 = detail::multi_miller_loop<curve_type>(
+                            detail::batch_precompute_g1<curve_type>(wkey.b.begin(), wkey.b.end()), b_precomp);
 
                         // (A * v)(w * B)
                         return std::make_pair(algebra::final_exponentiation<curve_type>(t1 * t2),
@@ -264,19 +262,12 @@ namespace nil {
                     static output_type single(const vkey_type &vkey, InputG1Iterator a_first, InputG1Iterator a_last) {
                         BOOST_ASSERT(vkey.has_correct_len(std::distance(a_first, a_last)));
 
-                        gt_value_type t1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.a.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.a.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          t1 = t1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
-
-                        gt_value_type u1 = gt_value_type::one();
-                        std::for_each(boost::make_zip_iterator(boost::make_tuple(a_first, vkey.b.begin())),
-                                      boost::make_zip_iterator(boost::make_tuple(a_last, vkey.b.end())),
-                                      [&](const boost::tuple<const g1_value_type &, const g2_value_type &> &t) {
-                                          u1 = u1 * algebra::pair<curve_type>(t.template get<0>(), t.template get<1>());
-                                      });
+                        const auto a_precomp = detail::batch_precompute_g1<curve_type>(a_first, a_last);
+
+                        gt_value_type t1 = detail::multi_miller_loop<curve_type>(
+                            a_precomp, detail::batch_precompute_g2<curve_type>(vkey.a.begin(), vkey.a.end()));
+                        gt_value_type u1 = detail::multi_miller_loop<curve_type>(
+                            a_precomp, detail::batch_precompute_g2<curve_type>(vkey.b.begin(), vkey.b.end()));
 
                         return std::make_pair(algebra::final_exponentiation<curve_type>(t1),
                                               algebra::final_exponentiation<curve_type>(u1));
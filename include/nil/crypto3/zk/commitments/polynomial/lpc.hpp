@@ -44,10 +44,12 @@ namespace nil {
         namespace zk {
             namespace commitments {
                 template<typename MerkleTreeHashType, typename TranscriptHashType, std::size_t Lambda = 40,
-                         std::size_t R = 1, std::size_t M = 2, std::size_t BatchSize = 0, bool IsConstSize = false>
+                         std::size_t R = 1, std::size_t M = 2, std::size_t BatchSize = 0, bool IsConstSize = false,
+                         typename TranscriptType = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>>
                 struct list_polynomial_commitment_params {
                     typedef MerkleTreeHashType merkle_hash_type;
                     typedef TranscriptHashType transcript_hash_type;
+                    typedef TranscriptType transcript_type;
 
                     constexpr static const std::size_t lambda = Lambda;
                     constexpr static const std::size_t r = R;
@@ -75,7 +77,8 @@ namespace nil {
                 struct batched_list_polynomial_commitment
                     : public detail::basic_batched_fri<FieldType, typename LPCParams::merkle_hash_type,
                                                        typename LPCParams::transcript_hash_type, LPCParams::m,
-                                                       LPCParams::leaf_size, LPCParams::is_const_size> {
+                                                       LPCParams::leaf_size, LPCParams::is_const_size,
+                                                       typename LPCParams::transcript_type> {
 
                     using merkle_hash_type = typename LPCParams::merkle_hash_type;
 
@@ -91,7 +94,7 @@ namespace nil {
 
                     using basic_fri = detail::basic_batched_fri<FieldType, typename LPCParams::merkle_hash_type,
                                                                 typename LPCParams::transcript_hash_type, m, leaf_size,
-                                                                is_const_size>;
+                                                                is_const_size, typename LPCParams::transcript_type>;
 
                     using precommitment_type = typename basic_fri::precommitment_type;
                     using commitment_type = typename basic_fri::commitment_type;
@@ -119,12 +122,14 @@ namespace nil {
                 using batched_lpc = batched_list_polynomial_commitment<
                     FieldType, commitments::list_polynomial_commitment_params<
                                    typename LPCParams::merkle_hash_type, typename LPCParams::transcript_hash_type,
-                                   LPCParams::lambda, LPCParams::r, LPCParams::m, BatchSize, IsConstSize>>;
+                                   LPCParams::lambda, LPCParams::r, LPCParams::m, BatchSize, IsConstSize,
+                                   typename LPCParams::transcript_type>>;
                 template<typename FieldType, typename LPCParams, std::size_t BatchSize, bool IsConstSize>
                 using lpc = batched_list_polynomial_commitment<
                     FieldType, list_polynomial_commitment_params<
                                    typename LPCParams::merkle_hash_type, typename LPCParams::transcript_hash_type,
-                                   LPCParams::lambda, LPCParams::r, LPCParams::m, BatchSize, IsConstSize>>;
+                                   LPCParams::lambda, LPCParams::r, LPCParams::m, BatchSize, IsConstSize,
+                                   typename LPCParams::transcript_type>>;
 
                 template<typename FieldType, typename LPCParams>
                 using list_polynomial_commitment = batched_list_polynomial_commitment<FieldType, LPCParams>;
@@ -215,11 +220,9 @@ namespace nil {
                     }
 
                     std::array<typename LPC::basic_fri::proof_type, LPC::lambda> fri_proof;
-
-                    for (std::size_t round_id = 0; round_id <= LPC::lambda - 1; round_id++) {
-                        fri_proof[round_id] = proof_eval<typename LPC::basic_fri>(Q, g, T, fri_params, transcript);
-                        BOOST_ASSERT(fri_proof[round_id].round_proofs[0].T_root == commit<typename LPC::basic_fri>(T));
-                    }
+                    std::vector<typename LPC::basic_fri::proof_type> query_proofs =
+                        multi_query_proof_eval<typename LPC::basic_fri>(Q, g, T, fri_params, LPC::lambda, transcript);
+                    std::move(query_proofs.begin(), query_proofs.end(), fri_proof.begin());
 
                     return typename LPC::proof_type({z, commit<typename LPC::basic_fri>(T), fri_proof});
                 }
@@ -387,10 +390,9 @@ namespace nil {
                         Q[polynom_index].resize(fri_params.D[0]->size());
                     }
 
-                    for (std::size_t round_id = 0; round_id <= LPC::lambda - 1; round_id++) {
-                        fri_proof[round_id] = proof_eval<typename LPC::basic_fri>(Q, g, T, fri_params, transcript);
-                        BOOST_ASSERT(fri_proof[round_id].round_proofs[0].T_root == commit<typename LPC::basic_fri>(T));
-                    }
+                    std::vector<typename LPC::basic_fri::proof_type> query_proofs =
+                        multi_query_proof_eval<typename LPC::basic_fri>(Q, g, T, fri_params, LPC::lambda, transcript);
+                    std::move(query_proofs.begin(), query_proofs.end(), fri_proof.begin());
 
                     return typename LPC::proof_type({z, commit<typename LPC::basic_fri>(T), fri_proof});
                 }
@@ -520,14 +522,8 @@ namespace nil {
                         }
                     }
 
-                    for (std::size_t round_id = 0; round_id <= LPC::lambda - 1; round_id++) {
-                        if (!verify_eval<typename LPC::basic_fri>(proof.fri_proof[round_id], fri_params, t_polynomials,
-                                                                  U, V, transcript)) {
-                            return false;
-                        }
-                    }
-
-                    return true;
+                    return multi_query_verify_eval<typename LPC::basic_fri>(proof.fri_proof, fri_params, t_polynomials,
+                                                                            U, V, transcript);
                 }
 
                 template<typename LPC, typename std::enable_if<
@@ -586,10 +582,12 @@ namespace nil {
 
                     std::array<typename LPC::basic_fri::proof_type, LPC::lambda> fri_proof;
 
-                    for (std::size_t round_id = 0; round_id <= LPC::lambda - 1; round_id++) {
-                        fri_proof[round_id] = proof_eval<typename LPC::basic_fri>(Q, g, T, fri_params, transcript);
-                        BOOST_ASSERT(fri_proof[round_id].round_proofs[0].T_root == commit<typename LPC::basic_fri>(T));
-                    }
+                    std::array<math::polynomial<typename LPC::field_type::value_type>, 1> Q_batch = {Q};
+                    std::array<math::polynomial<typename LPC::field_type::value_type>, 1> g_batch = {g};
+                    std::vector<typename LPC::basic_fri::proof_type> query_proofs =
+                        multi_query_proof_eval<typename LPC::basic_fri>(Q_batch, g_batch, T, fri_params, LPC::lambda,
+                                                                        transcript);
+                    std::move(query_proofs.begin(), query_proofs.end(), fri_proof.begin());
 
                     return typename LPC::proof_type({z, commit<typename LPC::basic_fri>(T), fri_proof});
                 }
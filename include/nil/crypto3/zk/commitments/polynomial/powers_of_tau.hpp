@@ -4,9 +4,11 @@
 #include <nil/crypto3/zk/commitments/detail/polynomial/powers_of_tau/private_key.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/powers_of_tau/public_key.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/powers_of_tau/accumulator.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/powers_of_tau/stream_accumulator.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/powers_of_tau/result.hpp>
 #include <nil/crypto3/zk/commitments/polynomial/proof_of_knowledge.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/vector_pairs.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/same_ratio_checks.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
@@ -31,6 +33,7 @@ namespace nil {
                     typedef detail::powers_of_tau_private_key<curve_type> private_key_type;
                     typedef detail::powers_of_tau_public_key<curve_type> public_key_type;
                     typedef detail::powers_of_tau_accumulator<curve_type, TauPowersLength> accumulator_type;
+                    typedef detail::powers_of_tau_stream_accumulator<curve_type> stream_accumulator_type;
                     typedef detail::powers_of_tau_result<curve_type> result_type;
                     typedef proof_of_knowledge<curve_type> proof_of_knowledge_scheme_type;
 
@@ -66,7 +69,15 @@ namespace nil {
                     static public_key_type proof_eval(const private_key_type &private_key,
                                                       const accumulator_type &before,
                                                       RNG &&rng = boost::random_device()) {
-                        std::vector<std::uint8_t> transcript = compute_transcript(before);
+                        return proof_eval(private_key, compute_transcript(before), rng);
+                    }
+
+                    // The transcript is the hash of the accumulator the contribution is applied to,
+                    // stream_accumulator_type::transform returns it for the streamed accumulators
+                    template<typename RNG = boost::random_device>
+                    static public_key_type proof_eval(const private_key_type &private_key,
+                                                      const std::vector<std::uint8_t> &transcript,
+                                                      RNG &&rng = boost::random_device()) {
                         auto tau_pok = proof_of_knowledge_scheme_type::proof_eval(
                             private_key.tau, transcript, tau_personalization, rng);
                         auto alpha_pok = proof_of_knowledge_scheme_type::proof_eval(
@@ -80,8 +91,13 @@ namespace nil {
                     static bool verify_eval(const public_key_type &public_key,
                                             const accumulator_type &before,
                                             const accumulator_type &after) {
-                        std::vector<std::uint8_t> transcript = compute_transcript(before);
+                        return verify_eval(public_key, before, after, compute_transcript(before));
+                    }
 
+                    static bool verify_eval(const public_key_type &public_key,
+                                            const accumulator_type &before,
+                                            const accumulator_type &after,
+                                            const std::vector<std::uint8_t> &transcript) {
                         auto tau_g2_s = proof_of_knowledge_scheme_type::compute_g2_s(
                             public_key.tau_pok.g1_s, public_key.tau_pok.g1_s_x, transcript, tau_personalization);
                         auto alpha_g2_s = proof_of_knowledge_scheme_type::compute_g2_s(
@@ -89,17 +105,6 @@ namespace nil {
                         auto beta_g2_s = proof_of_knowledge_scheme_type::compute_g2_s(
                             public_key.beta_pok.g1_s, public_key.beta_pok.g1_s_x, transcript, beta_personalization);
 
-                        // Verify the proofs of knowledge of tau, alpha and beta
-                        if (!proof_of_knowledge_scheme_type::verify_eval(public_key.tau_pok, tau_g2_s)) {
-                            return false;
-                        }
-                        if (!proof_of_knowledge_scheme_type::verify_eval(public_key.alpha_pok, alpha_g2_s)) {
-                            return false;
-                        }
-                        if (!proof_of_knowledge_scheme_type::verify_eval(public_key.beta_pok, beta_g2_s)) {
-                            return false;
-                        }
-
                         // Check the correctness of the generators fot tau powers
                         if (after.tau_powers_g1[0] != g1_value_type::one()) {
                             return false;
@@ -108,48 +113,43 @@ namespace nil {
                             return false;
                         }
 
+                        // All the pairing checks below are verified at once with a random linear combination
+                        detail::same_ratio_checks<curve_type> checks;
+
+                        // Verify the proofs of knowledge of tau, alpha and beta
+                        checks.add(std::make_pair(public_key.tau_pok.g1_s, public_key.tau_pok.g1_s_x),
+                                   std::make_pair(tau_g2_s, public_key.tau_pok.g2_s_x));
+                        checks.add(std::make_pair(public_key.alpha_pok.g1_s, public_key.alpha_pok.g1_s_x),
+                                   std::make_pair(alpha_g2_s, public_key.alpha_pok.g2_s_x));
+                        checks.add(std::make_pair(public_key.beta_pok.g1_s, public_key.beta_pok.g1_s_x),
+                                   std::make_pair(beta_g2_s, public_key.beta_pok.g2_s_x));
+
                         // Did the participant multiply the previous tau by the new one?
-                        if (!is_same_ratio(std::make_pair(before.tau_powers_g1[1], after.tau_powers_g1[1]),
-                                           std::make_pair(tau_g2_s, public_key.tau_pok.g2_s_x))) {
-                            return false;
-                        }
+                        checks.add(std::make_pair(before.tau_powers_g1[1], after.tau_powers_g1[1]),
+                                   std::make_pair(tau_g2_s, public_key.tau_pok.g2_s_x));
 
                         // Did the participant multiply the previous alpha by the new one?
-                        if (!is_same_ratio(std::make_pair(before.alpha_tau_powers_g1[0], after.alpha_tau_powers_g1[0]),
-                                           std::make_pair(alpha_g2_s, public_key.alpha_pok.g2_s_x))) {
-                            return false;
-                        }
+                        checks.add(std::make_pair(before.alpha_tau_powers_g1[0], after.alpha_tau_powers_g1[0]),
+                                   std::make_pair(alpha_g2_s, public_key.alpha_pok.g2_s_x));
 
                         // Did the participant multiply the previous beta by the new one?
-                        if (!is_same_ratio(std::make_pair(before.beta_tau_powers_g1[0], after.beta_tau_powers_g1[0]),
-                                           std::make_pair(beta_g2_s, public_key.beta_pok.g2_s_x))) {
-                            return false;
-                        }
+                        checks.add(std::make_pair(before.beta_tau_powers_g1[0], after.beta_tau_powers_g1[0]),
+                                   std::make_pair(beta_g2_s, public_key.beta_pok.g2_s_x));
 
-                        if (!is_same_ratio(std::make_pair(before.beta_tau_powers_g1[0], after.beta_tau_powers_g1[0]),
-                                           std::make_pair(before.beta_g2, after.beta_g2))) {
-                            return false;
-                        }
+                        checks.add(std::make_pair(before.beta_tau_powers_g1[0], after.beta_tau_powers_g1[0]),
+                                   std::make_pair(before.beta_g2, after.beta_g2));
 
                         // Are the powers of tau correct?
-                        if (!is_same_ratio(detail::power_pairs<scalar_field_type>(after.tau_powers_g1),
-                                           std::make_pair(after.tau_powers_g2[0], after.tau_powers_g2[1]))) {
-                            return false;
-                        }
-                        if (!is_same_ratio(std::make_pair(after.tau_powers_g1[0], after.tau_powers_g1[1]),
-                                           commitments::detail::power_pairs<scalar_field_type>(after.tau_powers_g2))) {
-                            return false;
-                        }
-                        if (!is_same_ratio(detail::power_pairs<scalar_field_type>(after.alpha_tau_powers_g1),
-                                           std::make_pair(after.tau_powers_g2[0], after.tau_powers_g2[1]))) {
-                            return false;
-                        }
-                        if (!is_same_ratio(detail::power_pairs<scalar_field_type>(after.beta_tau_powers_g1),
-                                           std::make_pair(after.tau_powers_g2[0], after.tau_powers_g2[1]))) {
-                            return false;
-                        }
-
-                        return true;
+                        checks.add(detail::power_pairs<scalar_field_type>(after.tau_powers_g1),
+                                   std::make_pair(after.tau_powers_g2[0], after.tau_powers_g2[1]));
+                        checks.add(std::make_pair(after.tau_powers_g1[0], after.tau_powers_g1[1]),
+                                   detail::power_pairs<scalar_field_type>(after.tau_powers_g2));
+                        checks.add(detail::power_pairs<scalar_field_type>(after.alpha_tau_powers_g1),
+                                   std::make_pair(after.tau_powers_g2[0], after.tau_powers_g2[1]));
+                        checks.add(detail::power_pairs<scalar_field_type>(after.beta_tau_powers_g1),
+                                   std::make_pair(after.tau_powers_g2[0], after.tau_powers_g2[1]));
+
+                        return checks.verify();
                     }
 
                     static bool is_same_ratio(const std::pair<g1_value_type, g1_value_type> &g1_pair,
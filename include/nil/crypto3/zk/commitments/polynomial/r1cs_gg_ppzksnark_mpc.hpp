@@ -32,6 +32,7 @@
 #include <nil/crypto3/zk/commitments/polynomial/knowledge_commitment.hpp>
 #include <nil/crypto3/zk/commitments/polynomial/proof_of_knowledge.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/vector_pairs.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/same_ratio_checks.hpp>
 #include <nil/crypto3/zk/commitments/detail/polynomial/r1cs_gg_ppzksnark_mpc/crs_operations.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
@@ -137,20 +138,23 @@ namespace nil {
                             return false;
                         }
 
+                        if (mpc_keypair.first.delta_g2 != mpc_keypair.second.delta_g2) {
+                            return false;
+                        }
+
+                        // All the pairing checks below are verified at once with a random linear combination
+                        detail::same_ratio_checks<curve_type> checks;
+
                         auto transcript = compute_transcript(mpc_keypair.first.constraint_system, boost::none);
                         auto current_delta = g1_value_type::one();
                         for (auto pk : pubkeys) {
                             auto g2_s = proof_of_knowledge_scheme_type::compute_g2_s(
                                 pk.delta_pok.g1_s, pk.delta_pok.g1_s_x, transcript, 0);
 
-                            if (!proof_of_knowledge_scheme_type::verify_eval(pk.delta_pok, g2_s)) {
-                                return false;
-                            }
-
-                            if (!is_same_ratio(std::make_pair(current_delta, pk.delta_after),
-                                               std::make_pair(g2_s, pk.delta_pok.g2_s_x))) {
-                                return false;
-                            }
+                            checks.add(std::make_pair(pk.delta_pok.g1_s, pk.delta_pok.g1_s_x),
+                                       std::make_pair(g2_s, pk.delta_pok.g2_s_x));
+                            checks.add(std::make_pair(current_delta, pk.delta_after),
+                                       std::make_pair(g2_s, pk.delta_pok.g2_s_x));
 
                             current_delta = pk.delta_after;
                             transcript = compute_transcript(mpc_keypair.first.constraint_system, pk);
@@ -160,34 +164,22 @@ namespace nil {
                             return false;
                         }
 
-                        if (!is_same_ratio(std::make_pair(g1_value_type::one(), current_delta),
-                                           std::make_pair(g2_value_type::one(), mpc_keypair.first.delta_g2))) {
-                            return false;
-                        }
-
-                        if (mpc_keypair.first.delta_g2 != mpc_keypair.second.delta_g2) {
-                            return false;
-                        }
+                        checks.add(std::make_pair(g1_value_type::one(), current_delta),
+                                   std::make_pair(g2_value_type::one(), mpc_keypair.first.delta_g2));
 
-                        if (!is_same_ratio(
-                                detail::merge_pairs<scalar_field_type>(initial_keypair.first.H_query.cbegin(),
-                                                                       initial_keypair.first.H_query.cend(),
-                                                                       mpc_keypair.first.H_query.cbegin(),
-                                                                       mpc_keypair.first.H_query.cend()),
-                                std::make_pair(mpc_keypair.first.delta_g2, g2_value_type::one()))) {
-                            return false;
-                        }
+                        checks.add(detail::merge_pairs<scalar_field_type>(initial_keypair.first.H_query.cbegin(),
+                                                                          initial_keypair.first.H_query.cend(),
+                                                                          mpc_keypair.first.H_query.cbegin(),
+                                                                          mpc_keypair.first.H_query.cend()),
+                                   std::make_pair(mpc_keypair.first.delta_g2, g2_value_type::one()));
 
-                        if (!is_same_ratio(
-                                detail::merge_pairs<scalar_field_type>(initial_keypair.first.L_query.cbegin(),
-                                                                       initial_keypair.first.L_query.cend(),
-                                                                       mpc_keypair.first.L_query.cbegin(),
-                                                                       mpc_keypair.first.L_query.cend()),
-                                std::make_pair(mpc_keypair.first.delta_g2, g2_value_type::one()))) {
-                            return false;
-                        }
+                        checks.add(detail::merge_pairs<scalar_field_type>(initial_keypair.first.L_query.cbegin(),
+                                                                          initial_keypair.first.L_query.cend(),
+                                                                          mpc_keypair.first.L_query.cbegin(),
+                                                                          mpc_keypair.first.L_query.cend()),
+                                   std::make_pair(mpc_keypair.first.delta_g2, g2_value_type::one()));
 
-                        return true;
+                        return checks.verify();
                     }
 
                     static bool is_same_ratio(const std::pair<g1_value_type, g1_value_type> &g1_pair,
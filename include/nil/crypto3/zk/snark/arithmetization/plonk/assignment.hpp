@@ -27,7 +27,14 @@
 #ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_TABLE_HPP
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_TABLE_HPP
 
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/column_view.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -37,109 +44,128 @@ namespace nil {
                 template<typename FieldType>
                 using plonk_column = std::vector<typename FieldType::value_type>;
 
+                // Columns are immutable once a table is built, so copies of a table share its columns and the
+                // accessors hand out references and views into them instead of copies.
                 template<typename FieldType, typename ArithmetizationParams, typename ColumnType>
                 struct plonk_private_table {
+                    typedef std::array<ColumnType, ArithmetizationParams::witness_columns> witnesses_type;
+                    typedef plonk_column_view<typename FieldType::value_type> column_view_type;
 
                 protected:
-                    std::array<ColumnType, ArithmetizationParams::witness_columns> witness_columns;
+                    std::shared_ptr<const witnesses_type> witness_columns;
 
                 public:
-                    plonk_private_table(
-                        std::array<ColumnType, ArithmetizationParams::witness_columns> witness_columns = {}) :
-                        witness_columns(witness_columns) {
+                    plonk_private_table(witnesses_type witness_columns = {}) :
+                        witness_columns(std::make_shared<const witnesses_type>(std::move(witness_columns))) {
                     }
 
-                    ColumnType witness(std::size_t index) const {
+                    const ColumnType &witness(std::size_t index) const {
                         BOOST_ASSERT(index < ArithmetizationParams::witness_columns);
 
-                        return witness_columns[index];
+                        return (*witness_columns)[index];
                     }
 
-                    std::array<ColumnType, ArithmetizationParams::witness_columns> witnesses() const {
-                        return witness_columns;
+                    column_view_type witness_view(std::size_t index) const {
+                        return column_view_type(witness(index));
                     }
 
-                    ColumnType operator[](std::size_t index) const {
-                        if (index < ArithmetizationParams::witness_columns)
-                            return witness_columns[index];
-                        index -= ArithmetizationParams::witness_columns;
+                    const witnesses_type &witnesses() const {
+                        return *witness_columns;
+                    }
+
+                    const ColumnType &operator[](std::size_t index) const {
+                        return witness(index);
                     }
 
                     constexpr std::size_t size() const {
-                        return witness_columns.size();
+                        return ArithmetizationParams::witness_columns;
                     }
                 };
 
                 template<typename FieldType, typename ArithmetizationParams, typename ColumnType>
                 struct plonk_public_table {
+                    typedef std::array<ColumnType, ArithmetizationParams::public_input_columns> public_inputs_type;
+                    typedef std::array<ColumnType, ArithmetizationParams::constant_columns> constants_type;
+                    typedef std::array<ColumnType, ArithmetizationParams::selector_columns> selectors_type;
+                    typedef plonk_column_view<typename FieldType::value_type> column_view_type;
 
                 protected:
-                    std::array<ColumnType, ArithmetizationParams::public_input_columns> public_input_columns;
-                    std::array<ColumnType, ArithmetizationParams::constant_columns> constant_columns;
-                    std::array<ColumnType, ArithmetizationParams::selector_columns> selector_columns;
+                    std::shared_ptr<const public_inputs_type> public_input_columns;
+                    std::shared_ptr<const constants_type> constant_columns;
+                    std::shared_ptr<const selectors_type> selector_columns;
 
                 public:
-                    plonk_public_table(
-                        std::array<ColumnType, ArithmetizationParams::public_input_columns> public_input_columns = {},
-                        std::array<ColumnType, ArithmetizationParams::constant_columns> constant_columns = {},
-                        std::array<ColumnType, ArithmetizationParams::selector_columns> selector_columns = {}) :
-                        public_input_columns(public_input_columns),
-                        constant_columns(constant_columns), selector_columns(selector_columns) {
+                    plonk_public_table(public_inputs_type public_input_columns = {},
+                                       constants_type constant_columns = {},
+                                       selectors_type selector_columns = {}) :
+                        public_input_columns(
+                            std::make_shared<const public_inputs_type>(std::move(public_input_columns))),
+                        constant_columns(std::make_shared<const constants_type>(std::move(constant_columns))),
+                        selector_columns(std::make_shared<const selectors_type>(std::move(selector_columns))) {
                     }
 
-                    ColumnType public_input(std::size_t index) const {
+                    const ColumnType &public_input(std::size_t index) const {
                         BOOST_ASSERT(index < ArithmetizationParams::public_input_columns);
 
-                        return public_input_columns[index];
+                        return (*public_input_columns)[index];
                     }
 
-                    std::array<ColumnType, ArithmetizationParams::public_input_columns> public_inputs() const {
-                        return public_input_columns;
+                    column_view_type public_input_view(std::size_t index) const {
+                        return column_view_type(public_input(index));
                     }
 
-                    std::size_t public_input_size() {
-                        return public_input_columns.size();
+                    const public_inputs_type &public_inputs() const {
+                        return *public_input_columns;
                     }
 
-                    ColumnType constant(std::size_t index) const {
+                    std::size_t public_input_size() const {
+                        return ArithmetizationParams::public_input_columns;
+                    }
+
+                    const ColumnType &constant(std::size_t index) const {
                         BOOST_ASSERT(index < ArithmetizationParams::constant_columns);
 
-                        return constant_columns[index];
+                        return (*constant_columns)[index];
+                    }
+
+                    column_view_type constant_view(std::size_t index) const {
+                        return column_view_type(constant(index));
                     }
 
-                    std::array<ColumnType, ArithmetizationParams::constant_columns> constants() const {
-                        return constant_columns;
+                    const constants_type &constants() const {
+                        return *constant_columns;
                     }
 
-                    std::size_t constant_size() {
-                        return constant_columns.size();
+                    std::size_t constant_size() const {
+                        return ArithmetizationParams::constant_columns;
                     }
 
-                    ColumnType selector(std::size_t index) const {
+                    const ColumnType &selector(std::size_t index) const {
                         BOOST_ASSERT(index < ArithmetizationParams::selector_columns);
 
-                        return selector_columns[index];
+                        return (*selector_columns)[index];
+                    }
+
+                    column_view_type selector_view(std::size_t index) const {
+                        return column_view_type(selector(index));
                     }
 
-                    std::array<ColumnType, ArithmetizationParams::selector_columns> selectors() const {
-                        return selector_columns;
+                    const selectors_type &selectors() const {
+                        return *selector_columns;
                     }
 
-                    std::size_t selectors_size() {
-                        return selector_columns.size();
+                    std::size_t selectors_size() const {
+                        return ArithmetizationParams::selector_columns;
                     }
 
-                    ColumnType operator[](std::size_t index) const {
+                    const ColumnType &operator[](std::size_t index) const {
                         if (index < ArithmetizationParams::public_input_columns)
-                            return public_input_columns[index];
+                            return public_input(index);
                         index -= ArithmetizationParams::public_input_columns;
                         if (index < ArithmetizationParams::constant_columns)
-                            return constant_columns[index];
+                            return constant(index);
                         index -= ArithmetizationParams::constant_columns;
-                        if (index < ArithmetizationParams::selector_columns) {
-                            return selector_columns[index];
-                        }
-                        index -= ArithmetizationParams::selector_columns;
+                        return selector(index);
                     }
 
                     constexpr std::size_t size() const {
@@ -153,6 +179,7 @@ namespace nil {
 
                     using private_table_type = plonk_private_table<FieldType, ArithmetizationParams, ColumnType>;
                     using public_table_type = plonk_public_table<FieldType, ArithmetizationParams, ColumnType>;
+                    using column_view_type = plonk_column_view<typename FieldType::value_type>;
 
                 protected:
                     private_table_type _private_table;
@@ -165,35 +192,50 @@ namespace nil {
                         _public_table(public_table) {
                     }
 
-                    ColumnType witness(std::size_t index) const {
+                    const ColumnType &witness(std::size_t index) const {
                         return _private_table.witness(index);
                     }
 
-                    ColumnType public_input(std::size_t index) const {
+                    const ColumnType &public_input(std::size_t index) const {
                         return _public_table.public_input(index);
                     }
 
-                    ColumnType constant(std::size_t index) const {
+                    const ColumnType &constant(std::size_t index) const {
                         return _public_table.constant(index);
                     }
 
-                    ColumnType selector(std::size_t index) const {
+                    const ColumnType &selector(std::size_t index) const {
                         return _public_table.selector(index);
                     }
 
-                    ColumnType operator[](std::size_t index) const {
+                    column_view_type witness_view(std::size_t index) const {
+                        return _private_table.witness_view(index);
+                    }
+
+                    column_view_type public_input_view(std::size_t index) const {
+                        return _public_table.public_input_view(index);
+                    }
+
+                    column_view_type constant_view(std::size_t index) const {
+                        return _public_table.constant_view(index);
+                    }
+
+                    column_view_type selector_view(std::size_t index) const {
+                        return _public_table.selector_view(index);
+                    }
+
+                    const ColumnType &operator[](std::size_t index) const {
                         if (index < _private_table.size())
                             return _private_table[index];
                         index -= _private_table.size();
-                        if (index < _public_table.size())
-                            return _public_table[index];
+                        return _public_table[index];
                     }
 
-                    private_table_type private_table() const {
+                    const private_table_type &private_table() const {
                         return _private_table;
                     }
 
-                    public_table_type public_table() const {
+                    const public_table_type &public_table() const {
                         return _public_table;
                     }
 
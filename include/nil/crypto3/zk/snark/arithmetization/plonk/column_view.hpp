@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_PLONK_COLUMN_VIEW_HPP
+#define CRYPTO3_ZK_PLONK_COLUMN_VIEW_HPP
+
+#include <cstddef>
+
+#include <boost/assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+
+                /*!
+                 * @brief Non-owning view of a column of a plonk table.
+                 *
+                 * The view points into the storage of the table it is taken from, so it is only valid while
+                 * that table is alive. Rows are addressed relative to a rotation and wrap around the column
+                 * size, the same way rotated variables address the rows of the table.
+                 */
+                template<typename ValueType>
+                class plonk_column_view {
+                public:
+                    typedef ValueType value_type;
+                    typedef const value_type *const_iterator;
+
+                    plonk_column_view() : _data(nullptr), _size(0) {
+                    }
+
+                    plonk_column_view(const value_type *data, std::size_t size) : _data(data), _size(size) {
+                    }
+
+                    template<typename ColumnType>
+                    explicit plonk_column_view(const ColumnType &column) :
+                        _data(column.size() > 0 ? &column[0] : nullptr), _size(column.size()) {
+                    }
+
+                    const value_type &operator[](std::size_t row) const {
+                        BOOST_ASSERT(row < _size);
+
+                        return _data[row];
+                    }
+
+                    const value_type &operator()(std::size_t row, int rotation) const {
+                        BOOST_ASSERT(_size > 0);
+
+                        const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(_size);
+                        std::ptrdiff_t shifted = (static_cast<std::ptrdiff_t>(row) + rotation) % size;
+                        if (shifted < 0) {
+                            shifted += size;
+                        }
+                        return _data[shifted];
+                    }
+
+                    const value_type *data() const {
+                        return _data;
+                    }
+
+                    std::size_t size() const {
+                        return _size;
+                    }
+
+                    bool empty() const {
+                        return _size == 0;
+                    }
+
+                    const_iterator begin() const {
+                        return _data;
+                    }
+
+                    const_iterator end() const {
+                        return _data + _size;
+                    }
+
+                private:
+                    const value_type *_data;
+                    std::size_t _size;
+                };
+
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_COLUMN_VIEW_HPP
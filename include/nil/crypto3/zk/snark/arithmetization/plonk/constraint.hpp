@@ -1,212 +1,350 @@
-//---------------------------------------------------------------------------//
-// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
-// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
-// Copyright (c) 2022 Ilia Shirobokov <i.shirobokov@nil.foundation>
-//
-// MIT License
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-//---------------------------------------------------------------------------//
-
-#ifndef CRYPTO3_ZK_PLONK_CONSTRAINT_HPP
-#define CRYPTO3_ZK_PLONK_CONSTRAINT_HPP
-
-#include <nil/crypto3/math/polynomial/polynomial.hpp>
-#include <nil/crypto3/math/polynomial/shift.hpp>
-#include <nil/crypto3/math/domains/evaluation_domain.hpp>
-
-#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
-#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
-#include <nil/crypto3/zk/math/non_linear_combination.hpp>
-
-namespace nil {
-    namespace crypto3 {
-        namespace zk {
-            namespace snark {
-                namespace detail {
-
-                    template<typename VariableType>
-                    using plonk_evaluation_map =
-                        std::map<std::tuple<std::size_t, int, typename VariableType::column_type>,
-                                 typename VariableType::assignment_type>;
-
-                }    // namespace detail
-
-                /************************* PLONK constraint ***********************************/
-
-                template<typename FieldType, typename VariableType = plonk_variable<FieldType>>
-                class plonk_constraint : public math::non_linear_combination<VariableType> {
-                public:
-                    typedef FieldType field_type;
-                    typedef VariableType variable_type;
-                    typedef math::non_linear_combination<VariableType> base_type;
-
-                    plonk_constraint() : math::non_linear_combination<VariableType>() {};
-
-                    plonk_constraint(const VariableType &var) : math::non_linear_combination<VariableType>(var) {
-                    }
-
-                    plonk_constraint(const math::non_linear_combination<VariableType> &nlc) :
-                        math::non_linear_combination<VariableType>(nlc) {
-                    }
-
-                    plonk_constraint(const math::non_linear_term<VariableType> &nlt) :
-                        math::non_linear_combination<VariableType>(nlt) {
-                    }
-
-                    plonk_constraint(const std::vector<math::non_linear_term<VariableType>> &terms) :
-                        math::non_linear_combination<VariableType>(terms) {
-                    }
-
-                    template<typename ArithmetizationParams>
-                    typename VariableType::assignment_type
-                        evaluate(std::size_t row_index,
-                                 const plonk_assignment_table<FieldType, ArithmetizationParams> &assignments) const {
-                        typename VariableType::assignment_type acc = VariableType::assignment_type::zero();
-                        for (const math::non_linear_term<VariableType> &nlt : this->terms) {
-                            typename VariableType::assignment_type term_value = nlt.coeff;
-
-                            for (const VariableType &var : nlt.vars) {
-
-                                typename VariableType::assignment_type assignment;
-                                switch (var.type) {
-                                    case VariableType::column_type::witness:
-                                        assignment = assignments.witness(var.index)[row_index + var.rotation];
-                                        break;
-                                    case VariableType::column_type::public_input:
-                                        assignment = assignments.public_input(var.index)[row_index + var.rotation];
-                                        break;
-                                    case VariableType::column_type::constant:
-                                        assignment = assignments.constant(var.index)[row_index + var.rotation];
-                                        break;
-                                    case VariableType::column_type::selector:
-                                        assignment = assignments.selector(var.index)[row_index + var.rotation];
-                                        break;
-                                }
-
-                                term_value = term_value * assignment;
-                            }
-                            acc = acc + term_value;
-                        }
-                        return acc;
-                    }
-
-                    template<typename ArithmetizationParams>
-                    math::polynomial<typename VariableType::assignment_type>
-                        evaluate(const plonk_polynomial_table<FieldType, ArithmetizationParams> &assignments,
-                                 std::shared_ptr<math::evaluation_domain<FieldType>>
-                                     domain) const {
-                        math::polynomial<typename VariableType::assignment_type> acc = {0};
-                        for (const math::non_linear_term<VariableType> &nlt : this->terms) {
-                            math::polynomial<typename VariableType::assignment_type> term_value = {nlt.coeff};
-
-                            for (const VariableType &var : nlt.vars) {
-
-                                math::polynomial<typename VariableType::assignment_type> assignment;
-                                switch (var.type) {
-                                    case VariableType::column_type::witness:
-                                        assignment = assignments.witness(var.index);
-                                        break;
-                                    case VariableType::column_type::public_input:
-                                        assignment = assignments.public_input(var.index);
-                                        break;
-                                    case VariableType::column_type::constant:
-                                        assignment = assignments.constant(var.index);
-                                        break;
-                                    case VariableType::column_type::selector:
-                                        assignment = assignments.selector(var.index);
-                                        break;
-                                }
-
-                                if (var.rotation != 0) {
-                                    assignment =
-                                        math::polynomial_shift(assignment, domain->get_domain_element(var.rotation));
-                                }
-
-                                term_value = term_value * assignment;
-                            }
-                            acc = acc + term_value;
-                        }
-                        return acc;
-                    }
-
-                    template<typename ArithmetizationParams>
-                    math::polynomial_dfs<typename VariableType::assignment_type>
-                        evaluate(const plonk_polynomial_dfs_table<FieldType, ArithmetizationParams> &assignments,
-                                 std::shared_ptr<math::evaluation_domain<FieldType>>
-                                     domain) const {
-                        math::polynomial_dfs<typename VariableType::assignment_type> acc(
-                            0, domain->m, FieldType::value_type::zero());
-                        for (const math::non_linear_term<VariableType> &nlt : this->terms) {
-                            math::polynomial_dfs<typename VariableType::assignment_type> term_value(
-                                0, domain->m, nlt.coeff);
-
-                            for (const VariableType &var : nlt.vars) {
-
-                                math::polynomial_dfs<typename VariableType::assignment_type> assignment;
-                                switch (var.type) {
-                                    case VariableType::column_type::witness:
-                                        assignment = assignments.witness(var.index);
-                                        break;
-                                    case VariableType::column_type::public_input:
-                                        assignment = assignments.public_input(var.index);
-                                        break;
-                                    case VariableType::column_type::constant:
-                                        assignment = assignments.constant(var.index);
-                                        break;
-                                    case VariableType::column_type::selector:
-                                        assignment = assignments.selector(var.index);
-                                        break;
-                                }
-
-                                if (var.rotation != 0) {
-                                    assignment = math::polynomial_shift(assignment, var.rotation, domain->m);
-                                }
-
-                                term_value = term_value * assignment;
-                            }
-                            acc = acc + term_value;
-                        }
-                        return acc;
-                    }
-
-                    typename VariableType::assignment_type
-                        evaluate(detail::plonk_evaluation_map<VariableType> &assignments) const {
-                        typename VariableType::assignment_type acc = VariableType::assignment_type::zero();
-                        for (const math::non_linear_term<VariableType> &nlt : this->terms) {
-                            typename VariableType::assignment_type term_value = nlt.coeff;
-
-                            for (const VariableType &var : nlt.vars) {
-                                std::tuple<std::size_t, int, typename VariableType::column_type> key =
-                                    std::make_tuple(var.index, var.rotation, var.type);
-
-                                BOOST_ASSERT(assignments.count(key) > 0);
-                                term_value = term_value * assignments[key];
-                            }
-                            acc = acc + term_value;
-                        }
-                        return acc;
-                    }
-                };
-            }    // namespace snark
-        }        // namespace zk
-    }            // namespace crypto3
-}    // namespace nil
-
-#endif    // CRYPTO3_ZK_PLONK_CONSTRAINT_HPP
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2022 Ilia Shirobokov <i.shirobokov@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_CONSTRAINT_HPP
+#define CRYPTO3_ZK_PLONK_CONSTRAINT_HPP
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/math/non_linear_combination.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    /**
+                     * @brief Dense numbering of the (column, rotation) pairs a proof opens.
+                     *
+                     * Columns are numbered globally, witnesses first, then public inputs, constants and selectors,
+                     * like the columns rotations of the preprocessor. The rotations of every column get consecutive
+                     * slots in the order of columns_rotations, so the openings of a proof fill the slots in their
+                     * own order. The layout depends only on the circuit, looking a variable up is a few array reads.
+                     */
+                    template<typename VariableType>
+                    class plonk_evaluation_layout {
+                        typedef typename VariableType::column_type column_type;
+
+                        // Global index of the first column of every column type
+                        std::array<std::size_t, 5> _first_column;
+                        // Smallest rotation of every column
+                        std::vector<int> _min_rotation;
+                        // Range of _rotation_slots of every column, columns() + 1 entries
+                        std::vector<std::size_t> _first_rotation;
+                        // Slot of every rotation between the smallest and the largest one of a column
+                        std::vector<std::size_t> _rotation_slots;
+                        std::size_t _size;
+
+                    public:
+                        constexpr static const std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+                        template<typename ColumnsRotationsType>
+                        plonk_evaluation_layout(const ColumnsRotationsType &columns_rotations,
+                                                std::size_t witness_columns, std::size_t public_input_columns,
+                                                std::size_t constant_columns) :
+                            _size(0) {
+                            _first_column[column_type::witness] = 0;
+                            _first_column[column_type::public_input] = witness_columns;
+                            _first_column[column_type::constant] = witness_columns + public_input_columns;
+                            _first_column[column_type::selector] =
+                                witness_columns + public_input_columns + constant_columns;
+                            _first_column[4] = columns_rotations.size();
+                            BOOST_ASSERT(_first_column[column_type::selector] <= _first_column[4]);
+
+                            _min_rotation.resize(columns_rotations.size(), 0);
+                            _first_rotation.resize(columns_rotations.size() + 1, 0);
+
+                            for (std::size_t i = 0; i < columns_rotations.size(); i++) {
+                                _first_rotation[i] = _rotation_slots.size();
+                                if (columns_rotations[i].empty()) {
+                                    continue;
+                                }
+
+                                const auto bounds =
+                                    std::minmax_element(columns_rotations[i].begin(), columns_rotations[i].end());
+                                _min_rotation[i] = *bounds.first;
+                                _rotation_slots.resize(_rotation_slots.size() + (*bounds.second - *bounds.first) + 1,
+                                                       npos);
+                                for (int rotation : columns_rotations[i]) {
+                                    _rotation_slots[_first_rotation[i] + (rotation - _min_rotation[i])] = _size++;
+                                }
+                            }
+                            _first_rotation[columns_rotations.size()] = _rotation_slots.size();
+                        }
+
+                        // Number of slots
+                        std::size_t size() const {
+                            return _size;
+                        }
+
+                        std::size_t columns() const {
+                            return _min_rotation.size();
+                        }
+
+                        // Slot of a global column at a rotation, npos if the column is not opened there
+                        std::size_t slot(std::size_t column, int rotation) const {
+                            if (column >= columns() || rotation < _min_rotation[column]) {
+                                return npos;
+                            }
+                            const std::size_t offset = static_cast<std::size_t>(rotation - _min_rotation[column]);
+                            if (offset >= _first_rotation[column + 1] - _first_rotation[column]) {
+                                return npos;
+                            }
+                            return _rotation_slots[_first_rotation[column] + offset];
+                        }
+
+                        std::size_t slot(const VariableType &var) const {
+                            const std::size_t column = _first_column[var.type] + var.index;
+                            if (column >= _first_column[var.type + 1]) {
+                                return npos;
+                            }
+                            return slot(column, var.rotation);
+                        }
+                    };
+
+                    /**
+                     * @brief Values of the opened columns, stored in the slots of a plonk_evaluation_layout.
+                     * Looking up a variable that is not opened throws std::out_of_range.
+                     */
+                    template<typename VariableType>
+                    class plonk_evaluation_map {
+                    public:
+                        typedef typename VariableType::assignment_type value_type;
+                        typedef plonk_evaluation_layout<VariableType> layout_type;
+
+                        explicit plonk_evaluation_map(std::shared_ptr<const layout_type> layout) :
+                            _layout(layout), _values(layout->size(), value_type::zero()) {
+                        }
+
+                        const layout_type &layout() const {
+                            return *_layout;
+                        }
+
+                        std::vector<value_type> &values() {
+                            return _values;
+                        }
+
+                        const std::vector<value_type> &values() const {
+                            return _values;
+                        }
+
+                        value_type &operator[](const VariableType &var) {
+                            return _values[slot(var)];
+                        }
+
+                        const value_type &operator[](const VariableType &var) const {
+                            return _values[slot(var)];
+                        }
+
+                    private:
+                        std::size_t slot(const VariableType &var) const {
+                            const std::size_t result = _layout->slot(var);
+                            if (result == layout_type::npos) {
+                                throw std::out_of_range("variable is not opened in the evaluation layout");
+                            }
+                            return result;
+                        }
+
+                        std::shared_ptr<const layout_type> _layout;
+                        std::vector<value_type> _values;
+                    };
+
+                }    // namespace detail
+
+                /************************* PLONK constraint ***********************************/
+
+                template<typename FieldType, typename VariableType = plonk_variable<FieldType>>
+                class plonk_constraint : public math::non_linear_combination<VariableType> {
+                public:
+                    typedef FieldType field_type;
+                    typedef VariableType variable_type;
+                    typedef math::non_linear_combination<VariableType> base_type;
+
+                    plonk_constraint() : math::non_linear_combination<VariableType>() {};
+
+                    plonk_constraint(const VariableType &var) : math::non_linear_combination<VariableType>(var) {
+                    }
+
+                    plonk_constraint(const math::non_linear_combination<VariableType> &nlc) :
+                        math::non_linear_combination<VariableType>(nlc) {
+                    }
+
+                    plonk_constraint(const math::non_linear_term<VariableType> &nlt) :
+                        math::non_linear_combination<VariableType>(nlt) {
+                    }
+
+                    plonk_constraint(const std::vector<math::non_linear_term<VariableType>> &terms) :
+                        math::non_linear_combination<VariableType>(terms) {
+                    }
+
+                    template<typename ArithmetizationParams>
+                    typename VariableType::assignment_type
+                        evaluate(std::size_t row_index,
+                                 const plonk_assignment_table<FieldType, ArithmetizationParams> &assignments) const {
+                        typename VariableType::assignment_type acc = VariableType::assignment_type::zero();
+                        for (const math::non_linear_term<VariableType> &nlt : this->terms) {
+                            typename VariableType::assignment_type term_value = nlt.coeff;
+
+                            for (const VariableType &var : nlt.vars) {
+
+                                typename VariableType::assignment_type assignment;
+                                switch (var.type) {
+                                    case VariableType::column_type::witness:
+                                        assignment = assignments.witness_view(var.index)(row_index, var.rotation);
+                                        break;
+                                    case VariableType::column_type::public_input:
+                                        assignment = assignments.public_input_view(var.index)(row_index, var.rotation);
+                                        break;
+                                    case VariableType::column_type::constant:
+                                        assignment = assignments.constant_view(var.index)(row_index, var.rotation);
+                                        break;
+                                    case VariableType::column_type::selector:
+                                        assignment = assignments.selector_view(var.index)(row_index, var.rotation);
+                                        break;
+                                }
+
+                                term_value = term_value * assignment;
+                            }
+                            acc = acc + term_value;
+                        }
+                        return acc;
+                    }
+
+                    template<typename ArithmetizationParams>
+                    math::polynomial<typename VariableType::assignment_type>
+                        evaluate(const plonk_polynomial_table<FieldType, ArithmetizationParams> &assignments,
+                                 std::shared_ptr<math::evaluation_domain<FieldType>>
+                                     domain) const {
+                        math::polynomial<typename VariableType::assignment_type> acc = {0};
+                        for (const math::non_linear_term<VariableType> &nlt : this->terms) {
+                            math::polynomial<typename VariableType::assignment_type> term_value = {nlt.coeff};
+
+                            for (const VariableType &var : nlt.vars) {
+
+                                math::polynomial<typename VariableType::assignment_type> assignment;
+                                switch (var.type) {
+                                    case VariableType::column_type::witness:
+                                        assignment = assignments.witness(var.index);
+                                        break;
+                                    case VariableType::column_type::public_input:
+                                        assignment = assignments.public_input(var.index);
+                                        break;
+                                    case VariableType::column_type::constant:
+                                        assignment = assignments.constant(var.index);
+                                        break;
+                                    case VariableType::column_type::selector:
+                                        assignment = assignments.selector(var.index);
+                                        break;
+                                }
+
+                                if (var.rotation != 0) {
+                                    assignment =
+                                        math::polynomial_shift(assignment, domain->get_domain_element(var.rotation));
+                                }
+
+                                term_value = term_value * assignment;
+                            }
+                            acc = acc + term_value;
+                        }
+                        return acc;
+                    }
+
+                    template<typename ArithmetizationParams>
+                    math::polynomial_dfs<typename VariableType::assignment_type>
+                        evaluate(const plonk_polynomial_dfs_table<FieldType, ArithmetizationParams> &assignments,
+                                 std::shared_ptr<math::evaluation_domain<FieldType>>
+                                     domain) const {
+                        math::polynomial_dfs<typename VariableType::assignment_type> acc(
+                            0, domain->m, FieldType::value_type::zero());
+                        for (const math::non_linear_term<VariableType> &nlt : this->terms) {
+                            math::polynomial_dfs<typename VariableType::assignment_type> term_value(
+                                0, domain->m, nlt.coeff);
+
+                            for (const VariableType &var : nlt.vars) {
+
+                                const math::polynomial_dfs<typename VariableType::assignment_type> *assignment =
+                                    nullptr;
+                                switch (var.type) {
+                                    case VariableType::column_type::witness:
+                                        assignment = &assignments.witness(var.index);
+                                        break;
+                                    case VariableType::column_type::public_input:
+                                        assignment = &assignments.public_input(var.index);
+                                        break;
+                                    case VariableType::column_type::constant:
+                                        assignment = &assignments.constant(var.index);
+                                        break;
+                                    case VariableType::column_type::selector:
+                                        assignment = &assignments.selector(var.index);
+                                        break;
+                                }
+                                BOOST_ASSERT(assignment != nullptr);
+
+                                // Only rotated columns are materialized, the others are read in place
+                                if (var.rotation != 0) {
+                                    term_value =
+                                        term_value * math::polynomial_shift(*assignment, var.rotation, domain->m);
+                                } else {
+                                    term_value = term_value * *assignment;
+                                }
+                            }
+                            acc = acc + term_value;
+                        }
+                        return acc;
+                    }
+
+                    typename VariableType::assignment_type
+                        evaluate(const detail::plonk_evaluation_map<VariableType> &assignments) const {
+                        typename VariableType::assignment_type acc = VariableType::assignment_type::zero();
+                        for (const math::non_linear_term<VariableType> &nlt : this->terms) {
+                            typename VariableType::assignment_type term_value = nlt.coeff;
+
+                            for (const VariableType &var : nlt.vars) {
+                                term_value = term_value * assignments[var];
+                            }
+                            acc = acc + term_value;
+                        }
+                        return acc;
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_CONSTRAINT_HPP
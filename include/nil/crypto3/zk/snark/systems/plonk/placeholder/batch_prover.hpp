@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_PROVER_HPP
+#define CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_PROVER_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <vector>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/prover.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                /**
+                 * @brief Proves many assignment tables of one circuit.
+                 *
+                 * All the proofs share the public preprocessed data, including its evaluation domain. Every
+                 * proof runs the whole private preprocessing and proving pipeline as one unit of work. With
+                 * MULTICORE the units are handed to OpenMP threads dynamically, so different stages of
+                 * different proofs run at the same time and a slow proof does not hold back the rest of the
+                 * batch. Parallel loops inside a proof run on the thread of that proof unless nested parallelism
+                 * is enabled. That is the right trade-off when throughput matters more than the latency of a
+                 * single proof.
+                 *
+                 * The threads share only const data: the constraint system, the table description, the
+                 * assignments, the commitment params and the public preprocessed data. The evaluation domains
+                 * behind them are only read, through fft, inverse_fft and get_domain_element. Transcripts,
+                 * leaves buffers and all the intermediate polynomials are local to a proof.
+                 */
+                template<typename FieldType, typename ParamsType>
+                class placeholder_batch_prover {
+                    using policy_type = detail::placeholder_policy<FieldType, ParamsType>;
+
+                    using prover_type = placeholder_prover<FieldType, ParamsType>;
+                    using public_preprocessor_type = placeholder_public_preprocessor<FieldType, ParamsType>;
+                    using private_preprocessor_type = placeholder_private_preprocessor<FieldType, ParamsType>;
+
+                public:
+                    typedef placeholder_proof<FieldType, ParamsType> proof_type;
+
+                    static inline std::vector<proof_type> process(
+                        const typename public_preprocessor_type::preprocessed_data_type &preprocessed_public_data,
+                        const plonk_table_description<FieldType, typename ParamsType::arithmetization_params>
+                            &table_description,
+                        const plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
+                            &constraint_system,
+                        const std::vector<typename policy_type::variable_assignment_type> &assignments,
+                        const typename ParamsType::commitment_params_type &fri_params) {
+
+                        std::vector<proof_type> proofs(assignments.size());
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic, 1) num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t i = 0; i < assignments.size(); i++) {
+                            typename private_preprocessor_type::preprocessed_data_type preprocessed_private_data =
+                                private_preprocessor_type::process(constraint_system, assignments[i].private_table(),
+                                                                   table_description,
+                                                                   preprocessed_public_data.common_data.basic_domain);
+
+                            proofs[i] = prover_type::process(preprocessed_public_data, preprocessed_private_data,
+                                                             table_description, constraint_system, assignments[i],
+                                                             fri_params);
+                        }
+
+                        return proofs;
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_PLACEHOLDER_BATCH_PROVER_HPP
@@ -0,0 +1,273 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_DETAIL_COMPILED_GATES_HPP
+#define CRYPTO3_ZK_PLONK_PLACEHOLDER_DETAIL_COMPILED_GATES_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/gate.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    /**
+                     * @brief Gates of a constraint system lowered to flat arrays.
+                     *
+                     * Every (column, rotation) pair referenced by the gates becomes an operand, every term is a
+                     * coefficient followed by a run of operand ids, and constraints and gates are runs of terms and
+                     * constraints respectively. evaluate() interpolates each referenced column once onto a domain
+                     * large enough for the gates degree and computes
+                     * \sum_i selector_i(X) \sum_j \theta^k constraint_{i,j}(X), k running over all the constraints,
+                     * in a single pass over blocks of rows.
+                     */
+                    template<typename FieldType>
+                    class compiled_gates {
+                        typedef typename FieldType::value_type value_type;
+                        typedef plonk_variable<FieldType> variable_type;
+                        typedef typename variable_type::column_type column_type;
+
+                        struct operand_type {
+                            std::size_t column;
+                            int rotation;
+                        };
+
+                        struct term_type {
+                            value_type coeff;
+                            std::size_t first_factor;
+                            std::size_t factors_number;
+                        };
+
+                        struct constraint_type {
+                            std::size_t first_term;
+                            std::size_t terms_number;
+                        };
+
+                        struct gate_type {
+                            std::size_t selector_column;
+                            std::size_t first_constraint;
+                            std::size_t constraints_number;
+                        };
+
+                        constexpr static const std::size_t rows_block_size = 256;
+
+                        std::vector<std::pair<column_type, std::size_t>> _columns;
+                        std::vector<operand_type> _operands;
+                        std::vector<std::size_t> _factors;
+                        std::vector<term_type> _terms;
+                        std::vector<constraint_type> _constraints;
+                        std::vector<gate_type> _gates;
+                        // Largest number of factors in a term, the selector included
+                        std::size_t _degree;
+
+                        std::size_t column_id(column_type type, std::size_t index,
+                                              std::map<std::pair<column_type, std::size_t>, std::size_t> &ids) {
+                            auto key = std::make_pair(type, index);
+                            auto it = ids.find(key);
+                            if (it != ids.end()) {
+                                return it->second;
+                            }
+                            ids.emplace(key, _columns.size());
+                            _columns.push_back(key);
+                            return _columns.size() - 1;
+                        }
+
+                        template<typename ArithmetizationParams>
+                        static math::polynomial_dfs<value_type>
+                            column(const plonk_polynomial_dfs_table<FieldType, ArithmetizationParams> &table,
+                                   const std::pair<column_type, std::size_t> &key) {
+                            switch (key.first) {
+                                case variable_type::column_type::witness:
+                                    return table.witness(key.second);
+                                case variable_type::column_type::public_input:
+                                    return table.public_input(key.second);
+                                case variable_type::column_type::constant:
+                                    return table.constant(key.second);
+                                case variable_type::column_type::selector:
+                                    return table.selector(key.second);
+                            }
+                            return math::polynomial_dfs<value_type>();
+                        }
+
+                    public:
+                        compiled_gates(const std::vector<plonk_gate<FieldType, plonk_constraint<FieldType>>> &gates) :
+                            _degree(0) {
+                            std::map<std::pair<column_type, std::size_t>, std::size_t> column_ids;
+                            std::map<std::tuple<std::size_t, int>, std::size_t> operand_ids;
+
+                            for (const auto &gate : gates) {
+                                _gates.push_back({column_id(variable_type::column_type::selector, gate.selector_index,
+                                                            column_ids),
+                                                  _constraints.size(), gate.constraints.size()});
+
+                                for (const auto &constraint : gate.constraints) {
+                                    _constraints.push_back({_terms.size(), constraint.terms.size()});
+
+                                    for (const auto &term : constraint.terms) {
+                                        _terms.push_back({term.coeff, _factors.size(), term.vars.size()});
+                                        _degree = std::max(_degree, term.vars.size() + 1);
+
+                                        for (const variable_type &var : term.vars) {
+                                            auto key = std::make_tuple(column_id(var.type, var.index, column_ids),
+                                                                       var.rotation);
+                                            auto it = operand_ids.find(key);
+                                            if (it == operand_ids.end()) {
+                                                it = operand_ids.emplace(key, _operands.size()).first;
+                                                _operands.push_back({std::get<0>(key), var.rotation});
+                                            }
+                                            _factors.push_back(it->second);
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        std::size_t constraints_number() const {
+                            return _constraints.size();
+                        }
+
+                        template<typename ArithmetizationParams>
+                        math::polynomial_dfs<value_type>
+                            evaluate(const plonk_polynomial_dfs_table<FieldType, ArithmetizationParams> &table,
+                                     std::size_t rows, const value_type &theta) const {
+
+                            if (_gates.empty()) {
+                                return math::polynomial_dfs<value_type>(0, rows, value_type::zero());
+                            }
+
+                            const std::size_t degree = _degree * (rows - 1);
+                            std::size_t extended_size = rows;
+                            while (extended_size < degree + 1) {
+                                extended_size <<= 1;
+                            }
+                            const std::size_t mask = extended_size - 1;
+                            const std::size_t rotation_step = extended_size / rows;
+
+                            std::vector<math::polynomial_dfs<value_type>> columns(_columns.size());
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < _columns.size(); i++) {
+                                columns[i] = column(table, _columns[i]);
+                                columns[i].resize(extended_size);
+                            }
+
+                            // On the extended domain a rotation by r rows is a shift by r * extended_size / rows
+                            std::vector<std::size_t> shifts(_operands.size());
+                            for (std::size_t i = 0; i < _operands.size(); i++) {
+                                shifts[i] = static_cast<std::size_t>(_operands[i].rotation *
+                                                                     static_cast<std::ptrdiff_t>(rotation_step)) &
+                                            mask;
+                            }
+
+                            std::vector<value_type> theta_powers(_constraints.size());
+                            value_type theta_acc = value_type::one();
+                            for (std::size_t i = 0; i < _constraints.size(); i++) {
+                                theta_powers[i] = theta_acc;
+                                theta_acc *= theta;
+                            }
+
+                            math::polynomial_dfs<value_type> result(degree, extended_size, value_type::zero());
+                            const std::size_t blocks = (extended_size + rows_block_size - 1) / rows_block_size;
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t block = 0; block < blocks; block++) {
+                                const std::size_t first_row = block * rows_block_size;
+                                const std::size_t block_rows = std::min(rows_block_size, extended_size - first_row);
+
+                                std::vector<value_type> gate_value(block_rows);
+                                std::vector<value_type> constraint_value(block_rows);
+                                std::vector<value_type> term_value(block_rows);
+
+                                for (const gate_type &gate : _gates) {
+                                    std::fill(gate_value.begin(), gate_value.end(), value_type::zero());
+
+                                    for (std::size_t c = gate.first_constraint;
+                                         c < gate.first_constraint + gate.constraints_number;
+                                         c++) {
+                                        const constraint_type &constraint = _constraints[c];
+                                        std::fill(constraint_value.begin(), constraint_value.end(),
+                                                  value_type::zero());
+
+                                        for (std::size_t t = constraint.first_term;
+                                             t < constraint.first_term + constraint.terms_number;
+                                             t++) {
+                                            const term_type &term = _terms[t];
+                                            std::fill(term_value.begin(), term_value.end(), term.coeff);
+
+                                            for (std::size_t f = term.first_factor;
+                                                 f < term.first_factor + term.factors_number;
+                                                 f++) {
+                                                const math::polynomial_dfs<value_type> &operand =
+                                                    columns[_operands[_factors[f]].column];
+                                                const std::size_t shift = shifts[_factors[f]];
+                                                for (std::size_t j = 0; j < block_rows; j++) {
+                                                    term_value[j] *= operand[(first_row + j + shift) & mask];
+                                                }
+                                            }
+
+                                            for (std::size_t j = 0; j < block_rows; j++) {
+                                                constraint_value[j] += term_value[j];
+                                            }
+                                        }
+
+                                        for (std::size_t j = 0; j < block_rows; j++) {
+                                            gate_value[j] += theta_powers[c] * constraint_value[j];
+                                        }
+                                    }
+
+                                    const math::polynomial_dfs<value_type> &selector = columns[gate.selector_column];
+                                    for (std::size_t j = 0; j < block_rows; j++) {
+                                        result[first_row + j] += selector[first_row + j] * gate_value[j];
+                                    }
+                                }
+                            }
+
+                            return result;
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_PLACEHOLDER_DETAIL_COMPILED_GATES_HPP
@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_DETAIL_GRAND_PRODUCT_HPP
+#define CRYPTO3_ZK_PLONK_PLACEHOLDER_DETAIL_GRAND_PRODUCT_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    inline std::size_t grand_product_chunks(std::size_t size) {
+#ifdef MULTICORE
+                        const std::size_t chunks = commitments::detail::multicore_threads();
+#else
+                        const std::size_t chunks = 1;
+#endif
+                        return std::max<std::size_t>(1, std::min(chunks, size));
+                    }
+
+                    /**
+                     * Replaces every element of values by its inverse with Montgomery's trick: each chunk is
+                     * inverted with one field inversion and three multiplications per element.
+                     * All the elements must be non-zero.
+                     */
+                    template<typename FieldType>
+                    void batch_inversion(std::vector<typename FieldType::value_type> &values) {
+                        const std::size_t size = values.size();
+                        const std::size_t chunks = grand_product_chunks(size);
+                        const std::size_t chunk_size = (size + chunks - 1) / chunks;
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+                            const std::size_t first = chunk * chunk_size;
+                            const std::size_t last = std::min(size, first + chunk_size);
+                            if (first >= last) {
+                                continue;
+                            }
+
+                            // prefix[i] is the product of values[first], ..., values[first + i - 1]
+                            std::vector<typename FieldType::value_type> prefix(last - first);
+                            typename FieldType::value_type acc = FieldType::value_type::one();
+                            for (std::size_t i = first; i < last; i++) {
+                                prefix[i - first] = acc;
+                                acc *= values[i];
+                            }
+
+                            acc = acc.inversed();
+                            for (std::size_t i = last; i-- > first;) {
+                                typename FieldType::value_type inversed = acc * prefix[i - first];
+                                acc *= values[i];
+                                values[i] = inversed;
+                            }
+                        }
+                    }
+
+                    /**
+                     * Running product of ratios: result[0] = 1, result[j] = result[j - 1] * ratios[j - 1].
+                     * Chunks are scanned in parallel, then shifted by the product of all the preceding chunks.
+                     */
+                    template<typename FieldType>
+                    std::vector<typename FieldType::value_type>
+                        grand_product(const std::vector<typename FieldType::value_type> &ratios) {
+                        const std::size_t size = ratios.size();
+                        const std::size_t chunks = grand_product_chunks(size);
+                        const std::size_t chunk_size = (size + chunks - 1) / chunks;
+
+                        std::vector<typename FieldType::value_type> result(size + 1);
+                        result[0] = FieldType::value_type::one();
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+                            const std::size_t first = chunk * chunk_size;
+                            const std::size_t last = std::min(size, first + chunk_size);
+                            typename FieldType::value_type acc = FieldType::value_type::one();
+                            for (std::size_t i = first; i < last; i++) {
+                                acc *= ratios[i];
+                                result[i + 1] = acc;
+                            }
+                        }
+
+                        // offsets[chunk] is the product of all the ratios before the chunk
+                        std::vector<typename FieldType::value_type> offsets(chunks, FieldType::value_type::one());
+                        for (std::size_t chunk = 1; chunk < chunks; chunk++) {
+                            const std::size_t last = std::min(size, chunk * chunk_size);
+                            offsets[chunk] = last > (chunk - 1) * chunk_size ? offsets[chunk - 1] * result[last] :
+                                                                               offsets[chunk - 1];
+                        }
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t chunk = 1; chunk < chunks; chunk++) {
+                            const std::size_t first = chunk * chunk_size;
+                            const std::size_t last = std::min(size, first + chunk_size);
+                            for (std::size_t i = first; i < last; i++) {
+                                result[i + 1] *= offsets[chunk];
+                            }
+                        }
+
+                        return result;
+                    }
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_PLACEHOLDER_DETAIL_GRAND_PRODUCT_HPP
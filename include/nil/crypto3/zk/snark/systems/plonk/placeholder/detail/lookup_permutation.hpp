@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_DETAIL_LOOKUP_PERMUTATION_HPP
+#define CRYPTO3_ZK_PLONK_PLACEHOLDER_DETAIL_LOOKUP_PERMUTATION_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    /**
+                     * Builds the permuted lookup columns (A', S') from the compressed inputs A and the compressed
+                     * table S: A' is A sorted, and S' is a permutation of S with S'[i] = A'[i] wherever A'[i]
+                     * starts a run of equal values. Both columns are sorted once and merged, the table values
+                     * left over by the merge fill the remaining rows of S'.
+                     * Returns false if some input is not in the table, S' is then still a permutation of S.
+                     */
+                    template<typename ColumnType>
+                    bool lookup_permutation(const ColumnType &input, const ColumnType &value, ColumnType &perm_input,
+                                            ColumnType &perm_value) {
+                        typedef typename std::iterator_traits<decltype(input.begin())>::value_type value_type;
+
+                        const std::size_t size = std::distance(input.begin(), input.end());
+                        BOOST_ASSERT(size == static_cast<std::size_t>(std::distance(value.begin(), value.end())));
+
+                        perm_input = input;
+                        std::sort(perm_input.begin(), perm_input.end());
+
+                        std::vector<value_type> sorted_value(value.begin(), value.end());
+                        std::sort(sorted_value.begin(), sorted_value.end());
+
+                        perm_value = value;
+                        std::vector<bool> matched(size, false);
+                        std::vector<value_type> unused;
+                        unused.reserve(size);
+
+                        bool result = true;
+                        std::size_t p = 0;
+                        for (std::size_t i = 0; i < size; i++) {
+                            if (i > 0 && perm_input[i] == perm_input[i - 1]) {
+                                continue;
+                            }
+                            while (p < size && sorted_value[p] < perm_input[i]) {
+                                unused.push_back(sorted_value[p++]);
+                            }
+                            if (p < size && sorted_value[p] == perm_input[i]) {
+                                perm_value[i] = sorted_value[p++];
+                                matched[i] = true;
+                            } else {
+                                result = false;
+                            }
+                        }
+                        unused.insert(unused.end(), sorted_value.begin() + p, sorted_value.end());
+
+                        std::size_t u = 0;
+                        for (std::size_t i = 0; i < size; i++) {
+                            if (!matched[i]) {
+                                perm_value[i] = unused[u++];
+                            }
+                        }
+                        BOOST_ASSERT(u == unused.size());
+
+                        return result;
+                    }
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_PLACEHOLDER_DETAIL_LOOKUP_PERMUTATION_HPP
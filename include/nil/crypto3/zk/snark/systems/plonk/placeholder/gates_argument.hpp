@@ -29,6 +29,7 @@
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_GATES_ARGUMENT_HPP
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
@@ -42,99 +43,70 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/compiled_gates.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace snark {
-                template<typename FieldType, typename ParamsType, typename ComponentType, std::size_t ArgumentSize = 1>
+                template<typename FieldType, typename ParamsType, std::size_t ArgumentSize = 1>
                 struct placeholder_gates_argument;
 
-                template<typename FieldType, typename ParamsType, typename ComponentType>
-                struct placeholder_gates_argument<FieldType, ParamsType, ComponentType, 1> {
+                template<typename FieldType, typename ParamsType>
+                struct placeholder_gates_argument<FieldType, ParamsType, 1> {
 
                     typedef typename ParamsType::transcript_hash_type transcript_hash_type;
-                    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
+                    using transcript_type = typename ParamsType::transcript_type;
 
                     typedef detail::placeholder_policy<FieldType, ParamsType> policy_type;
 
                     constexpr static const std::size_t argument_size = 1;
 
-                    static inline std::array<math::polynomial<typename FieldType::value_type>, argument_size>
+                    static inline std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size>
                         prove_eval(
-                            typename policy_type::constraint_system_type &constraint_system,
+                            const typename policy_type::constraint_system_type &constraint_system,
                             const plonk_polynomial_dfs_table<FieldType, typename ParamsType::arithmetization_params>
                                 &column_polynomials,
                             std::shared_ptr<math::evaluation_domain<FieldType>>
                                 domain,
-                            transcript_type &transcript = transcript_type()) {    // TODO: remove domain
+                            transcript_type &transcript = transcript_type()) {
 
                         typename FieldType::value_type theta = transcript.template challenge<FieldType>();
 
-                        std::array<math::polynomial<typename FieldType::value_type>, argument_size> F;
-                        F[0] = {0};
+                        std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size> F;
 
-                        typename FieldType::value_type theta_acc = FieldType::value_type::one();
+                        // All the gates are evaluated together in one pass over the rows
+                        F[0] = detail::compiled_gates<FieldType>(constraint_system.gates())
+                                   .evaluate(column_polynomials, domain->m, theta);
 
-                        //                        const std::vector<plonk_gate<FieldType, plonk_constraint<FieldType>>>
-                        //                        gates =
-                        //                            constraint_system.gates();
-
-                        //                        for (std::size_t i = 0; i < gates.size(); i++) {
-                        //                            math::polynomial_dfs<typename FieldType::value_type> gate_result(
-                        //                                0, domain->m, FieldType::value_type::zero());
-                        //
-                        //                            for (std::size_t j = 0; j < gates[i].constraints.size(); j++) {
-                        //                                gate_result = gate_result +
-                        //                                              gates[i].constraints[j].evaluate(column_polynomials,
-                        //                                              domain) * theta_acc;
-                        //                                theta_acc *= theta;
-                        //                            }
-                        //
-                        //                            gate_result = gate_result *
-                        //                            column_polynomials.selector(gates[i].selector_index);
-                        //
-                        //                            F[0] = F[0] + math::polynomial<typename
-                        //                            FieldType::value_type>(gate_result.coefficients());
-                        //                        }
-                        std::vector<math::polynomial_dfs<typename FieldType::value_type>> gates_results =
-                            ComponentType::evaluate_gates(column_polynomials.private_table().witnesses(), theta);
-                        auto gate_result = gates_results[0] * column_polynomials.selector(0);
-                        //
-                        //  for (std::size_t i = 0; i < gates_results.size(); i++){
-                        F[0] = F[0] + math::polynomial<typename FieldType::value_type>(gate_result.coefficients());
-                        //  }
                         return F;
                     }
 
                     static inline std::array<typename FieldType::value_type, argument_size>
                         verify_eval(const std::vector<plonk_gate<FieldType, plonk_constraint<FieldType>>> &gates,
-                                    typename policy_type::evaluation_map &evaluations,
+                                    const typename policy_type::evaluation_map &evaluations,
                                     const typename FieldType::value_type &challenge,
                                     transcript_type &transcript = transcript_type()) {
                         typename FieldType::value_type theta = transcript.template challenge<FieldType>();
 
                         std::array<typename FieldType::value_type, argument_size> F;
+                        F[0] = FieldType::value_type::zero();
 
                         typename FieldType::value_type theta_acc = FieldType::value_type::one();
-                        std::array<typename plonk_variable<FieldType>::assignment_type, 11> evaluation_values;
-                        for (std::size_t i = 0; i < 11; i++) {
-                            std::tuple<std::size_t, int, typename plonk_variable<FieldType>::column_type> key =
-                                std::make_tuple(i, 0, plonk_variable<FieldType>::column_type::witness);
-                            evaluation_values[i] = evaluations[key];
-                        }
 
-                        std::tuple<std::size_t, int, typename plonk_variable<FieldType>::column_type> selector_key =
-                            std::make_tuple(0, 0, plonk_variable<FieldType>::column_type::selector);
-                        std::vector<typename plonk_variable<FieldType>::assignment_type> gates_results =
-                            ComponentType::evaluate_gates(evaluation_values, theta);
-                        auto gate_result = gates_results[0] * evaluations[selector_key];
-                        F[0] = F[0] + gate_result;
-                        for (std::size_t i = 1; i < gates_results.size(); i++) {
-                            gate_result = (gate_result + gates_results[i]) * evaluations[selector_key];
+                        for (std::size_t i = 0; i < gates.size(); i++) {
+                            typename FieldType::value_type gate_result = FieldType::value_type::zero();
+
+                            for (std::size_t j = 0; j < gates[i].constraints.size(); j++) {
+                                gate_result = gate_result + gates[i].constraints[j].evaluate(evaluations) * theta_acc;
+                                theta_acc *= theta;
+                            }
+
+                            const plonk_variable<FieldType> selector(gates[i].selector_index, 0, true,
+                                                                     plonk_variable<FieldType>::column_type::selector);
 
-                            F[0] = F[0] + gate_result;
+                            F[0] = F[0] + gate_result * evaluations[selector];
                         }
 
                         return F;
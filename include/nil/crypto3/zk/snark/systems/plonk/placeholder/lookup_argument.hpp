@@ -28,7 +28,10 @@
 #ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_LOOKUP_ARGUMENT_HPP
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_LOOKUP_ARGUMENT_HPP
 
+#include <stdexcept>
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
@@ -42,6 +45,10 @@
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/verification_key.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/grand_product.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/lookup_permutation.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -50,16 +57,45 @@ namespace nil {
                 template<typename FieldType, typename CommitmentSchemeTypePermutation, typename ParamsType>
                 class placeholder_lookup_argument {
                     using transcript_hash_type = typename ParamsType::transcript_hash_type;
-                    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
+                    using transcript_type = typename ParamsType::transcript_type;
                     using VariableType = plonk_variable<FieldType>;
 
                     static constexpr std::size_t argument_size = 5;
 
                     typedef detail::placeholder_policy<FieldType, ParamsType> policy_type;
+                    typedef plonk_column_view<typename FieldType::value_type> column_view_type;
+                    typedef placeholder_verification_key<FieldType, ParamsType> verification_key_type;
+
+                    struct lookup_term {
+                        column_view_type input;
+                        int input_rotation;
+                        typename FieldType::value_type input_factor;
+                        column_view_type value;
+                        int value_rotation;
+                        typename FieldType::value_type value_factor;
+                        column_view_type selector;
+                    };
+
+                    static column_view_type
+                        column(const plonk_assignment_table<FieldType, typename ParamsType::arithmetization_params>
+                                   &plonk_columns,
+                               const VariableType &var) {
+                        switch (var.type) {
+                            case VariableType::column_type::witness:
+                                return plonk_columns.witness_view(var.index);
+                            case VariableType::column_type::public_input:
+                                return plonk_columns.public_input_view(var.index);
+                            case VariableType::column_type::constant:
+                                return plonk_columns.constant_view(var.index);
+                            case VariableType::column_type::selector:
+                                return plonk_columns.selector_view(var.index);
+                        }
+                        return column_view_type();
+                    }
 
                 public:
                     struct prover_lookup_result {
-                        std::array<math::polynomial<typename FieldType::value_type>, argument_size> F;
+                        std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size> F;
                         math::polynomial<typename FieldType::value_type> input_polynomial;
                         typename CommitmentSchemeTypePermutation::precommitment_type input_precommitment;
                         math::polynomial<typename FieldType::value_type> value_polynomial;
@@ -68,7 +104,7 @@ namespace nil {
                         typename CommitmentSchemeTypePermutation::precommitment_type V_L_precommitment;
                     };
                     static inline prover_lookup_result prove_eval(
-                        plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
+                        const plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
                             &constraint_system,
                         const typename placeholder_public_preprocessor<FieldType, ParamsType>::preprocessed_data_type
                             &preprocessed_data,
@@ -86,7 +122,7 @@ namespace nil {
                         std::shared_ptr<math::evaluation_domain<FieldType>> basic_domain =
                             preprocessed_data.common_data.basic_domain;
 
-                        std::array<math::polynomial<typename FieldType::value_type>, argument_size> F;
+                        std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size> F;
 
                         math::polynomial_dfs<typename FieldType::value_type> F_compr_input(basic_domain->m - 1,
                                                                                            basic_domain->m, 0);
@@ -94,82 +130,50 @@ namespace nil {
                         math::polynomial_dfs<typename FieldType::value_type> F_compr_value(basic_domain->m - 1,
                                                                                            basic_domain->m, 0);
 
+                        // Flatten the lookups into terms, so that both compressions are built in one pass per row
+                        std::vector<lookup_term> terms;
                         typename FieldType::value_type theta_acc = FieldType::value_type::one();
-
-                        // Construct the input lookup compression and table compression values
-                        // TODO: change to new form
                         for (std::size_t i = 0; i < lookup_gates.size(); i++) {
+                            const column_view_type selector =
+                                plonk_columns.selector_view(lookup_gates[i].selector_index);
                             for (std::size_t j = 0; j < lookup_gates[i].constraints.size(); j++) {
-                                for (math::non_linear_term<VariableType> lookup :
-                                     lookup_gates[i].constraints[j].lookup_input) {
-                                    int k = 0;
-                                    std::vector<typename FieldType::value_type> input_assignment;
-                                    std::vector<typename FieldType::value_type> value_assignment;
-                                    switch (lookup.vars[0].type) {
-                                        case VariableType::column_type::witness:
-                                            input_assignment = plonk_columns.witness(lookup.vars[0].index);
-                                            break;
-                                        case VariableType::column_type::public_input:
-                                            input_assignment = plonk_columns.public_input(lookup.vars[0].index);
-                                            break;
-                                        case VariableType::column_type::constant:
-                                            input_assignment = plonk_columns.constant(lookup.vars[0].index);
-                                            break;
-                                        case VariableType::column_type::selector:
-                                            break;
-                                    }
-                                    switch (lookup_gates[i].constraints[j].lookup_value[k].type) {
-                                        case VariableType::column_type::witness:
-                                            value_assignment = plonk_columns.witness(
-                                                lookup_gates[i].constraints[j].lookup_value[k].index);
-                                            break;
-                                        case VariableType::column_type::public_input:
-                                            value_assignment = plonk_columns.public_input(
-                                                lookup_gates[i].constraints[j].lookup_value[k].index);
-                                            break;
-                                        case VariableType::column_type::constant:
-                                            value_assignment = plonk_columns.constant(
-                                                lookup_gates[i].constraints[j].lookup_value[k].index);
-                                            break;
-                                        case VariableType::column_type::selector:
-                                            break;
-                                    }
-                                    for (std::size_t t = 0; t < basic_domain->m; t++) {
-                                        F_compr_input[t] =
-                                            F_compr_input[t] +
-                                            theta_acc *
-                                                input_assignment[(j + lookup.vars[0].rotation) %
-                                                                 input_assignment.size()] *
-                                                lookup.coeff *
-                                                plonk_columns.selector(lookup_gates[i].selector_index)[t];
-                                        F_compr_value[t] =
-                                            F_compr_value[t] +
-                                            theta_acc * value_assignment[j] *
-                                                plonk_columns.selector(lookup_gates[i].selector_index)[t];
-                                    }
-                                    k++;
+                                const plonk_lookup_constraint<FieldType> &constraint = lookup_gates[i].constraints[j];
+                                BOOST_ASSERT(constraint.lookup_value.size() >= constraint.lookup_input.size());
+                                for (std::size_t k = 0; k < constraint.lookup_input.size(); k++) {
+                                    const math::non_linear_term<VariableType> &lookup = constraint.lookup_input[k];
+                                    terms.push_back({column(plonk_columns, lookup.vars[0]), lookup.vars[0].rotation,
+                                                     theta_acc * lookup.coeff,
+                                                     column(plonk_columns, constraint.lookup_value[k]),
+                                                     constraint.lookup_value[k].rotation, theta_acc, selector});
                                     theta_acc = theta * theta_acc;
                                 }
                             }
                         }
 
-                        // Produce the permutation polynomials $S_{\texttt{perm}}(X)$ and $A_{\texttt{perm}}(X)$
-                        math::polynomial_dfs<typename FieldType::value_type> F_perm_input = F_compr_input;
-                        std::sort(F_perm_input.begin(), F_perm_input.end());
-                        // to-do better sort for F_perm_value
-                        math::polynomial_dfs<typename FieldType::value_type> F_perm_value = F_compr_value;
-                        F_perm_value[0] = F_perm_input[0];
-                        for (std::size_t i = 1; i < basic_domain->m; i++) {
-                            if (F_perm_input[i] != F_perm_input[i - 1]) {
-                                if (F_perm_input[i] != F_perm_value[i]) {
-                                    auto index = std::distance(
-                                        F_perm_value.begin(),
-                                        std::find(F_perm_value.begin(), F_perm_value.end(), F_perm_input[i]));
-                                    auto tmp = F_perm_value[i];
-                                    F_perm_value[i] = F_perm_value[index];
-                                    F_perm_value[index] = tmp;
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t t = 0; t < basic_domain->m; t++) {
+                            typename FieldType::value_type input = FieldType::value_type::zero();
+                            typename FieldType::value_type value = FieldType::value_type::zero();
+                            for (const lookup_term &term : terms) {
+                                const typename FieldType::value_type &selector = term.selector(t, 0);
+                                if (selector == FieldType::value_type::zero()) {
+                                    continue;
                                 }
+                                input += term.input_factor * term.input(t, term.input_rotation) * selector;
+                                value += term.value_factor * term.value(t, term.value_rotation) * selector;
                             }
+                            F_compr_input[t] = input;
+                            F_compr_value[t] = value;
+                        }
+
+                        // Produce the permutation polynomials $S_{\texttt{perm}}(X)$ and $A_{\texttt{perm}}(X)$
+                        math::polynomial_dfs<typename FieldType::value_type> F_perm_input;
+                        math::polynomial_dfs<typename FieldType::value_type> F_perm_value;
+                        // An input missing from the table leaves no valid permutation, so there is no proof
+                        if (!detail::lookup_permutation(F_compr_input, F_compr_value, F_perm_input, F_perm_value)) {
+                            throw std::invalid_argument("lookup input is not in the lookup table");
                         }
 
                         math::polynomial<typename FieldType::value_type> F_perm_input_normal =
@@ -195,14 +199,30 @@ namespace nil {
                         typename FieldType::value_type beta = transcript.template challenge<FieldType>();
                         typename FieldType::value_type gamma = transcript.template challenge<FieldType>();
 
-                        math::polynomial_dfs<typename FieldType::value_type> V_L(basic_domain->m - 1, basic_domain->m);
+                        // V_L[j] = V_L[j - 1] * g[j - 1] / h[j - 1], with all the denominators inverted in one batch
+                        std::vector<typename FieldType::value_type> numerators(basic_domain->m - 1);
+                        std::vector<typename FieldType::value_type> denominators(basic_domain->m - 1);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t j = 0; j < basic_domain->m - 1; j++) {
+                            numerators[j] = (F_compr_input[j] + beta) * (F_compr_value[j] + gamma);
+                            denominators[j] = (F_perm_input[j] + beta) * (F_perm_value[j] + gamma);
+                        }
 
-                        V_L[0] = FieldType::value_type::one();
-                        for (std::size_t j = 1; j < basic_domain->m; j++) {
-                            V_L[j] = (V_L[j - 1] * (F_compr_input[j - 1] + beta) * (F_compr_value[j - 1] + gamma)) *
-                                     ((F_perm_input[j - 1] + beta) * (F_perm_value[j - 1] + gamma)).inversed();
+                        detail::batch_inversion<FieldType>(denominators);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t j = 0; j < basic_domain->m - 1; j++) {
+                            numerators[j] *= denominators[j];
                         }
 
+                        std::vector<typename FieldType::value_type> V_L_values =
+                            detail::grand_product<FieldType>(numerators);
+                        math::polynomial_dfs<typename FieldType::value_type> V_L(basic_domain->m - 1, basic_domain->m);
+                        std::copy(V_L_values.begin(), V_L_values.end(), V_L.begin());
+
                         math::polynomial<typename FieldType::value_type> V_L_normal =
                             math::polynomial<typename FieldType::value_type>(V_L.coefficients());
 
@@ -227,20 +247,13 @@ namespace nil {
                         math::polynomial_dfs<typename FieldType::value_type> F_perm_input_shifted =
                             math::polynomial_shift(F_perm_input, -1, basic_domain->m);
 
-                        F[0] = math::polynomial<typename FieldType::value_type>(
-                            (preprocessed_data.common_data.lagrange_0 * (one_polynomial - V_L)).coefficients());
-                        F[1] = math::polynomial<typename FieldType::value_type>(
-                            ((one_polynomial - (preprocessed_data.q_last + preprocessed_data.q_blind)) *
-                             (V_L_shifted * h - V_L * g))
-                                .coefficients());
-                        F[2] = math::polynomial<typename FieldType::value_type>(
-                            (preprocessed_data.q_last * (V_L * V_L - V_L)).coefficients());
-                        F[3] = math::polynomial<typename FieldType::value_type>(
-                            (preprocessed_data.common_data.lagrange_0 * (F_perm_input - F_perm_value)).coefficients());
-                        F[4] = math::polynomial<typename FieldType::value_type>(
-                            ((one_polynomial - (preprocessed_data.q_last + preprocessed_data.q_blind)) *
-                             (F_perm_input - F_perm_value) * (F_perm_input - F_perm_input_shifted))
-                                .coefficients());
+                        F[0] = preprocessed_data.common_data.lagrange_0 * (one_polynomial - V_L);
+                        F[1] = (one_polynomial - (preprocessed_data.q_last + preprocessed_data.q_blind)) *
+                               (V_L_shifted * h - V_L * g);
+                        F[2] = preprocessed_data.q_last * (V_L * V_L - V_L);
+                        F[3] = preprocessed_data.common_data.lagrange_0 * (F_perm_input - F_perm_value);
+                        F[4] = (one_polynomial - (preprocessed_data.q_last + preprocessed_data.q_blind)) *
+                               (F_perm_input - F_perm_value) * (F_perm_input - F_perm_input_shifted);
 
                         return {F,
                                 F_perm_input_normal,
@@ -257,7 +270,33 @@ namespace nil {
                         const std::vector<plonk_gate<FieldType, plonk_lookup_constraint<FieldType>>> &lookup_gates,
                         // y
                         const typename FieldType::value_type &challenge,
-                        typename policy_type::evaluation_map &evaluations,
+                        const typename policy_type::evaluation_map &evaluations,
+                        // A_perm(y):
+                        const typename FieldType::value_type &F_perm_input_polynomial_value,
+                        // A_perm(y * omega ^ {-1}):
+                        const typename FieldType::value_type &F_perm_input_shifted_polynomial_value,
+                        // S_perm(y):
+                        const typename FieldType::value_type &F_perm_value_polynomial_value,
+                        // V_L(y):
+                        const typename FieldType::value_type &V_L_polynomial_value,
+                        // V_P(omega * y):
+                        const typename FieldType::value_type &V_L_polynomial_shifted_value,
+                        const typename CommitmentSchemeTypePermutation::commitment_type &F_perm_input_commitment,
+                        const typename CommitmentSchemeTypePermutation::commitment_type &F_perm_value_commitment,
+                        const typename CommitmentSchemeTypePermutation::commitment_type &V_L_commitment,
+                        transcript_type &transcript = transcript_type()) {
+                        return verify_eval(verification_key_type::evaluate(preprocessed_data, challenge), lookup_gates,
+                                           evaluations, F_perm_input_polynomial_value,
+                                           F_perm_input_shifted_polynomial_value, F_perm_value_polynomial_value,
+                                           V_L_polynomial_value, V_L_polynomial_shifted_value, F_perm_input_commitment,
+                                           F_perm_value_commitment, V_L_commitment, transcript);
+                    }
+
+                    static inline std::array<typename FieldType::value_type, argument_size> verify_eval(
+                        // Z, lagrange_0, q_last, q_blind at y:
+                        const typename verification_key_type::evaluations_type &public_values,
+                        const std::vector<plonk_gate<FieldType, plonk_lookup_constraint<FieldType>>> &lookup_gates,
+                        const typename policy_type::evaluation_map &evaluations,
                         // A_perm(y):
                         const typename FieldType::value_type &F_perm_input_polynomial_value,
                         // A_perm(y * omega ^ {-1}):
@@ -285,29 +324,21 @@ namespace nil {
                         typename FieldType::value_type theta_acc = FieldType::value_type::one();
 
                         for (std::size_t i = 0; i < lookup_gates.size(); i++) {
+                            const typename FieldType::value_type &selector_value = evaluations[VariableType(
+                                lookup_gates[i].selector_index, 0, true, VariableType::column_type::selector)];
+
                             for (std::size_t j = 0; j < lookup_gates[i].constraints.size(); j++) {
-                                for (math::non_linear_term<VariableType> lookup :
-                                     lookup_gates[i].constraints[j].lookup_input) {
-                                    int k = 0;
-                                    std::tuple<std::size_t, int, typename VariableType::column_type> input_key =
-                                        std::make_tuple(lookup.vars[0].index, lookup.vars[0].rotation,
-                                                        lookup.vars[0].type);
-                                    std::tuple<std::size_t, int, typename VariableType::column_type> value_key =
-                                        std::make_tuple(lookup_gates[i].constraints[j].lookup_value[k].index,
-                                                        lookup_gates[i].constraints[j].lookup_value[k].rotation,
-                                                        lookup_gates[i].constraints[j].lookup_value[k].type);
-
-                                    std::tuple<std::size_t, int, typename plonk_variable<FieldType>::column_type>
-                                        selector_key =
-                                            std::make_tuple(lookup_gates[i].selector_index, 0,
-                                                            plonk_variable<FieldType>::column_type::selector);
-
-                                    F_input_compr = F_input_compr + theta_acc * evaluations[input_key] * lookup.coeff *
-                                                                        evaluations[selector_key];
+                                for (std::size_t k = 0; k < lookup_gates[i].constraints[j].lookup_input.size(); k++) {
+                                    const math::non_linear_term<VariableType> &lookup =
+                                        lookup_gates[i].constraints[j].lookup_input[k];
+
+                                    F_input_compr = F_input_compr + theta_acc * evaluations[lookup.vars[0]] *
+                                                                        lookup.coeff * selector_value;
 
                                     F_value_compr =
-                                        F_value_compr + theta_acc * evaluations[value_key] * evaluations[selector_key];
-                                    k++;
+                                        F_value_compr +
+                                        theta_acc * evaluations[lookup_gates[i].constraints[j].lookup_value[k]] *
+                                            selector_value;
                                     theta_acc = theta * theta_acc;
                                 }
                             }
@@ -322,17 +353,14 @@ namespace nil {
                             (F_perm_input_polynomial_value + beta) * (F_perm_value_polynomial_value + gamma);
                         std::array<typename FieldType::value_type, argument_size> F;
                         typename FieldType::value_type one = FieldType::value_type::one();
-                        F[0] =
-                            preprocessed_data.common_data.lagrange_0.evaluate(challenge) * (one - V_L_polynomial_value);
-                        F[1] = (one - preprocessed_data.q_last.evaluate(challenge) -
-                                preprocessed_data.q_blind.evaluate(challenge)) *
+                        F[0] = public_values.lagrange_0 * (one - V_L_polynomial_value);
+                        F[1] = (one - public_values.q_last - public_values.q_blind) *
                                (V_L_polynomial_shifted_value * h - V_L_polynomial_value * g);
-                        F[2] = preprocessed_data.q_last.evaluate(challenge) *
+                        F[2] = public_values.q_last *
                                (V_L_polynomial_value * V_L_polynomial_value - V_L_polynomial_value);
-                        F[3] = preprocessed_data.common_data.lagrange_0.evaluate(challenge) *
+                        F[3] = public_values.lagrange_0 *
                                (F_perm_input_polynomial_value - F_perm_value_polynomial_value);
-                        F[4] = (one - preprocessed_data.q_last.evaluate(challenge) -
-                                preprocessed_data.q_blind.evaluate(challenge)) *
+                        F[4] = (one - public_values.q_last - public_values.q_blind) *
                                (F_perm_input_polynomial_value - F_perm_value_polynomial_value) *
                                (F_perm_input_polynomial_value - F_perm_input_shifted_polynomial_value);
 
@@ -38,11 +38,13 @@ namespace nil {
                 template<typename FieldType, typename ArithmetizationParams,
                          typename MerkleTreeHashType = hashes::keccak_1600<512>,
                          typename TranscriptHashType = hashes::keccak_1600<512>, std::size_t Lambda = 40,
-                         std::size_t R = 1, std::size_t M = 2>
+                         std::size_t R = 1, std::size_t M = 2,
+                         typename TranscriptType = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>>
                 struct placeholder_params {
 
                     typedef MerkleTreeHashType merkle_hash_type;
                     typedef TranscriptHashType transcript_hash_type;
+                    typedef TranscriptType transcript_type;
 
                     constexpr static const std::size_t witness_columns = ArithmetizationParams::witness_columns;
                     constexpr static const std::size_t public_input_columns = ArithmetizationParams::public_input_columns;
@@ -55,11 +57,11 @@ namespace nil {
                         algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
 
                     typedef
-                        typename commitments::fri<FieldType, MerkleTreeHashType, TranscriptHashType, M, 1>::params_type
-                            commitment_params_type;
+                        typename commitments::fri<FieldType, MerkleTreeHashType, TranscriptHashType, M, 1, true,
+                                                  TranscriptType>::params_type commitment_params_type;
 
                     typedef commitments::list_polynomial_commitment_params<MerkleTreeHashType, TranscriptHashType,
-                                                                           Lambda, R, M>
+                                                                           Lambda, R, M, 0, false, TranscriptType>
                         batched_commitment_params_type;
 
                     using fixed_values_commitment_scheme_type =
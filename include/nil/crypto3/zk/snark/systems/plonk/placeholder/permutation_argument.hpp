@@ -40,7 +40,10 @@
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/grand_product.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/verification_key.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -50,15 +53,16 @@ namespace nil {
                 class placeholder_permutation_argument {
 
                     using transcript_hash_type = typename ParamsType::transcript_hash_type;
-                    using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
+                    using transcript_type = typename ParamsType::transcript_type;
 
                     static constexpr std::size_t argument_size = 3;
 
                     using permutation_commitment_scheme_type = typename ParamsType::permutation_commitment_scheme_type;
+                    using verification_key_type = placeholder_verification_key<FieldType, ParamsType>;
 
                 public:
                     struct prover_result_type {
-                        std::array<math::polynomial<typename FieldType::value_type>, argument_size> F;
+                        std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size> F;
 
                         math::polynomial<typename FieldType::value_type> permutation_polynomial;
 
@@ -66,10 +70,10 @@ namespace nil {
                     };
 
                     static inline prover_result_type prove_eval(
-                        plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
+                        const plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
                             &constraint_system,
                         const typename placeholder_public_preprocessor<FieldType, ParamsType>::preprocessed_data_type
-                            preprocessed_data,
+                            &preprocessed_data,
                         const plonk_table_description<FieldType, typename ParamsType::arithmetization_params>
                             &table_description,
                         const plonk_polynomial_dfs_table<FieldType, typename ParamsType::arithmetization_params>
@@ -104,15 +108,33 @@ namespace nil {
                             h_v.push_back(column_polynomials[i] + beta * S_sigma[i] + gamma);
                         }
 
-                        V_P[0] = FieldType::value_type::one();
-                        for (std::size_t j = 1; j < basic_domain->size(); j++) {
-                            typename FieldType::value_type coeff = FieldType::value_type::one();
-
+                        // V_P[j] = V_P[j - 1] * \prod_i g_v[i][j - 1] / h_v[i][j - 1], with all the denominators
+                        // inverted in one batch
+                        std::vector<typename FieldType::value_type> numerators(basic_domain->size() - 1);
+                        std::vector<typename FieldType::value_type> denominators(basic_domain->size() - 1);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t j = 0; j < basic_domain->size() - 1; j++) {
+                            numerators[j] = FieldType::value_type::one();
+                            denominators[j] = FieldType::value_type::one();
                             for (std::size_t i = 0; i < S_id.size(); i++) {
-                                coeff *= g_v[i][j - 1] / h_v[i][j - 1];
+                                numerators[j] *= g_v[i][j];
+                                denominators[j] *= h_v[i][j];
                             }
-                            V_P[j] = V_P[j - 1] * coeff;
                         }
+
+                        detail::batch_inversion<FieldType>(denominators);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t j = 0; j < basic_domain->size() - 1; j++) {
+                            numerators[j] *= denominators[j];
+                        }
+
+                        std::vector<typename FieldType::value_type> V_P_values =
+                            detail::grand_product<FieldType>(numerators);
+                        std::copy(V_P_values.begin(), V_P_values.end(), V_P.begin());
                         V_P.resize(fri_params.D[0]->m);
 
                         math::polynomial<typename FieldType::value_type> V_P_normal =
@@ -140,18 +162,14 @@ namespace nil {
 
                         math::polynomial_dfs<typename FieldType::value_type> one_polynomial(
                             0, V_P.size(), FieldType::value_type::one());
-                        std::array<math::polynomial<typename FieldType::value_type>, argument_size> F;
+                        std::array<math::polynomial_dfs<typename FieldType::value_type>, argument_size> F;
                         math::polynomial_dfs<typename FieldType::value_type> V_P_shifted =
                             math::polynomial_shift(V_P, 1, basic_domain->m);
 
-                        F[0] = math::polynomial<typename FieldType::value_type>(
-                            (preprocessed_data.common_data.lagrange_0 * (one_polynomial - V_P)).coefficients());
-                        F[1] = math::polynomial<typename FieldType::value_type>(
-                            ((one_polynomial - (preprocessed_data.q_last + preprocessed_data.q_blind)) *
-                             (V_P_shifted * h - V_P * g))
-                                .coefficients());
-                        F[2] = math::polynomial<typename FieldType::value_type>(
-                            (preprocessed_data.q_last * (V_P * V_P - V_P)).coefficients());
+                        F[0] = preprocessed_data.common_data.lagrange_0 * (one_polynomial - V_P);
+                        F[1] = (one_polynomial - (preprocessed_data.q_last + preprocessed_data.q_blind)) *
+                               (V_P_shifted * h - V_P * g);
+                        F[2] = preprocessed_data.q_last * (V_P * V_P - V_P);
                         prover_result_type res = {F, V_P_normal, V_P_tree};
 
                         return res;
@@ -171,10 +189,36 @@ namespace nil {
                         const typename permutation_commitment_scheme_type::commitment_type &V_P_commitment,
                         transcript_type &transcript = transcript_type()) {
 
-                        const std::vector<math::polynomial_dfs<typename FieldType::value_type>> &S_sigma =
-                            preprocessed_data.permutation_polynomials;
-                        const std::vector<math::polynomial_dfs<typename FieldType::value_type>> &S_id =
-                            preprocessed_data.identity_polynomials;
+                        std::vector<typename FieldType::value_type> S_id_values(column_polynomials_values.size());
+                        std::vector<typename FieldType::value_type> S_sigma_values(column_polynomials_values.size());
+                        for (std::size_t i = 0; i < column_polynomials_values.size(); i++) {
+                            S_id_values[i] = preprocessed_data.identity_polynomials[i].evaluate(challenge);
+                            S_sigma_values[i] = preprocessed_data.permutation_polynomials[i].evaluate(challenge);
+                        }
+
+                        return verify_eval(verification_key_type::evaluate(preprocessed_data, challenge),
+                                           column_polynomials_values, S_id_values, S_sigma_values,
+                                           perm_polynomial_value, perm_polynomial_shifted_value, V_P_commitment,
+                                           transcript);
+                    }
+
+                    static inline std::array<typename FieldType::value_type, argument_size> verify_eval(
+                        // Z, lagrange_0, q_last, q_blind at y:
+                        const typename verification_key_type::evaluations_type &public_values,
+                        // f(y):
+                        const std::vector<typename FieldType::value_type> &column_polynomials_values,
+                        // S_id(y), S_sigma(y):
+                        const std::vector<typename FieldType::value_type> &S_id_values,
+                        const std::vector<typename FieldType::value_type> &S_sigma_values,
+                        // V_P(y):
+                        const typename FieldType::value_type &perm_polynomial_value,
+                        // V_P(omega * y):
+                        const typename FieldType::value_type &perm_polynomial_shifted_value,
+                        const typename permutation_commitment_scheme_type::commitment_type &V_P_commitment,
+                        transcript_type &transcript = transcript_type()) {
+
+                        BOOST_ASSERT(S_id_values.size() >= column_polynomials_values.size());
+                        BOOST_ASSERT(S_sigma_values.size() >= column_polynomials_values.size());
 
                         // 1. Get beta, gamma
                         typename FieldType::value_type beta = transcript.template challenge<FieldType>();
@@ -190,20 +234,17 @@ namespace nil {
                         for (std::size_t i = 0; i < column_polynomials_values.size(); i++) {
                             auto pp = column_polynomials_values[i] + gamma;
 
-                            g = g * (pp + beta * S_id[i].evaluate(challenge));
-                            h = h * (pp + beta * S_sigma[i].evaluate(challenge));
+                            g = g * (pp + beta * S_id_values[i]);
+                            h = h * (pp + beta * S_sigma_values[i]);
                         }
 
                         std::array<typename FieldType::value_type, argument_size> F;
                         typename FieldType::value_type one = FieldType::value_type::one();
 
-                        F[0] = preprocessed_data.common_data.lagrange_0.evaluate(challenge) *
-                               (one - perm_polynomial_value);
-                        F[1] = (one - preprocessed_data.q_last.evaluate(challenge) -
-                                preprocessed_data.q_blind.evaluate(challenge)) *
+                        F[0] = public_values.lagrange_0 * (one - perm_polynomial_value);
+                        F[1] = (one - public_values.q_last - public_values.q_blind) *
                                (perm_polynomial_shifted_value * h - perm_polynomial_value * g);
-                        F[2] = preprocessed_data.q_last.evaluate(challenge) *
-                               (perm_polynomial_value.squared() - perm_polynomial_value);
+                        F[2] = public_values.q_last * (perm_polynomial_value.squared() - perm_polynomial_value);
 
                         return F;
                     }
@@ -28,6 +28,8 @@
 #ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_PREPROCESSOR_HPP
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_PREPROCESSOR_HPP
 
+#include <stdexcept>
+
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
@@ -39,6 +41,7 @@
 #include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/detail/column_polynomial.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -184,88 +187,116 @@ namespace nil {
                         return f;
                     }
 
+                    /*
+                     * Cycles of the copy constraints over the cells of the table. The cell (column, row) lives at
+                     * column * rows + row of flat arrays: _mapping is the permutation, _aux the label of the
+                     * cycle of the cell and _sizes the size of a cycle at its label. Merging two cycles relabels
+                     * the smaller one and swaps the successors of the two cells. A copy constraint naming a cell
+                     * outside of the table is rejected with std::invalid_argument.
+                     */
                     struct cycle_representation {
-                        typedef std::pair<std::size_t, std::size_t> key_type;
-
-                        std::map<key_type, key_type> _mapping;
-                        std::map<key_type, key_type> _aux;
-                        std::map<key_type, std::size_t> _sizes;
+                        std::size_t _rows;
+                        std::vector<std::size_t> _mapping;
+                        std::vector<std::size_t> _aux;
+                        std::vector<std::size_t> _sizes;
 
                         cycle_representation(
-                            plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
+                            const plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
                                 &constraint_system,
                             const plonk_table_description<FieldType, typename ParamsType::arithmetization_params>
-                                &table_description) {
-
-                            for (std::size_t i = 0;
-                                 i < table_description.table_width() - table_description.selector_columns;
-                                 i++) {
-                                for (std::size_t j = 0; j < table_description.rows_amount; j++) {
-                                    key_type key(i, j);
-                                    this->_mapping[key] = key;
-                                    this->_aux[key] = key;
-                                    this->_sizes[key] = 1;
-                                }
+                                &table_description) :
+                            _rows(table_description.rows_amount) {
+
+                            const std::size_t cells =
+                                (table_description.table_width() - table_description.selector_columns) * _rows;
+                            _mapping.resize(cells);
+                            _aux.resize(cells);
+                            _sizes.assign(cells, 1);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < cells; i++) {
+                                _mapping[i] = i;
+                                _aux[i] = i;
                             }
 
-                            std::vector<plonk_copy_constraint<FieldType>> copy_constraints =
+                            const std::vector<plonk_copy_constraint<FieldType>> &copy_constraints =
                                 constraint_system.copy_constraints();
                             for (std::size_t i = 0; i < copy_constraints.size(); i++) {
-                                std::size_t x_idx = table_description.global_index(copy_constraints[i].first);
-                                key_type x = key_type(x_idx, copy_constraints[i].first.rotation);
-
-                                std::size_t y_idx = table_description.global_index(copy_constraints[i].second);
-                                key_type y = key_type(y_idx, copy_constraints[i].second.rotation);
+                                std::size_t x = cell(table_description.global_index(copy_constraints[i].first),
+                                                     copy_constraints[i].first.rotation);
+                                std::size_t y = cell(table_description.global_index(copy_constraints[i].second),
+                                                     copy_constraints[i].second.rotation);
                                 this->apply_copy_constraint(x, y);
                             }
                         }
 
-                        void apply_copy_constraint(key_type x, key_type y) {
-
-                            if (!_mapping.count(x)) {
-                                _mapping[x] = x;
-                                _aux[x] = x;
-                                _sizes[x] = 1;
+                        // Flat index of a cell named by a copy constraint, which is checked against the table
+                        std::size_t cell(std::size_t column, int row) const {
+                            if (column >= columns() || row < 0 || static_cast<std::size_t>(row) >= _rows) {
+                                throw std::invalid_argument("copy constraint cell is out of the table");
                             }
+                            return index(column, row);
+                        }
+
+                        std::size_t index(std::size_t column, std::size_t row) const {
+                            BOOST_ASSERT(row < _rows);
+                            BOOST_ASSERT(column * _rows + row < _mapping.size());
 
-                            if (!_mapping.count(y)) {
-                                _mapping[y] = y;
-                                _aux[y] = y;
-                                _sizes[y] = 1;
+                            return column * _rows + row;
+                        }
+
+                        void apply_copy_constraint(std::size_t x, std::size_t y) {
+                            if (_aux[x] == _aux[y]) {
+                                return;
+                            }
+                            if (_sizes[_aux[x]] < _sizes[_aux[y]]) {
+                                std::swap(x, y);
                             }
 
-                            if (_aux[x] != _aux[y]) {
-                                key_type &left = x;
-                                key_type &right = y;
-                                if (_sizes[_aux[left]] < _sizes[_aux[right]]) {
-                                    std::swap(left, right);
-                                }
+                            const std::size_t left = _aux[x];
+                            const std::size_t right = _aux[y];
+                            _sizes[left] += _sizes[right];
 
-                                _sizes[_aux[left]] = _sizes[_aux[left]] + _sizes[_aux[right]];
+                            std::size_t z = right;
+                            do {
+                                _aux[z] = left;
+                                z = _mapping[z];
+                            } while (z != right);
 
-                                key_type z = _aux[right];
-                                key_type exit_condition = _aux[right];
+                            std::swap(_mapping[x], _mapping[y]);
+                        }
 
-                                do {
-                                    _aux[z] = _aux[left];
-                                    z = _mapping[z];
-                                } while (z != exit_condition);
+                        std::size_t rows() const {
+                            return _rows;
+                        }
 
-                                key_type tmp = _mapping[left];
-                                _mapping[left] = _mapping[right];
-                                _mapping[right] = tmp;
-                            }
+                        std::size_t columns() const {
+                            return _rows > 0 ? _mapping.size() / _rows : 0;
                         }
 
-                        key_type &operator[](key_type key) {
-                            return _mapping[key];
+                        // Flat index of the cell the cell (column, row) is mapped to
+                        std::size_t operator()(std::size_t column, std::size_t row) const {
+                            return _mapping[index(column, row)];
                         }
                     };
 
+                    // omega^j for every row j of the domain
+                    static inline std::vector<typename FieldType::value_type>
+                        omega_powers(const typename FieldType::value_type &omega, std::size_t size) {
+                        std::vector<typename FieldType::value_type> powers(size);
+                        typename FieldType::value_type power = FieldType::value_type::one();
+                        for (std::size_t j = 0; j < size; j++) {
+                            powers[j] = power;
+                            power *= omega;
+                        }
+                        return powers;
+                    }
+
                 public:
                     static inline std::array<std::vector<int>, ParamsType::arithmetization_params::total_columns>
                         columns_rotations(
-                            plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
+                            const plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
                                 &constraint_system,
                             const plonk_table_description<FieldType, typename ParamsType::arithmetization_params>
                                 &table_description) {
@@ -359,13 +390,19 @@ namespace nil {
                                              const typename ParamsType::commitment_params_type &commitment_params) {
 
                         std::vector<math::polynomial_dfs<typename FieldType::value_type>> S_id(permutation_size);
+                        const std::vector<typename FieldType::value_type> omegas =
+                            omega_powers(omega, domain->size());
 
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
                         for (std::size_t i = 0; i < permutation_size; i++) {
+                            const typename FieldType::value_type delta_power = delta.pow(i);
                             S_id[i] = math::polynomial_dfs<typename FieldType::value_type>(
                                 domain->size() - 1, domain->size(), FieldType::value_type::zero());
 
                             for (std::size_t j = 0; j < domain->size(); j++) {
-                                S_id[i][j] = delta.pow(i) * omega.pow(j);
+                                S_id[i][j] = delta_power * omegas[j];
                             }
 
                             // S_id[i].resize(commitment_params.D[0]->size());
@@ -383,15 +420,32 @@ namespace nil {
                                                     domain,
                                                 const typename ParamsType::commitment_params_type &commitment_params) {
 
+                        BOOST_ASSERT(permutation.rows() == domain->size());
+
+                        const std::vector<typename FieldType::value_type> omegas =
+                            omega_powers(omega, domain->size());
+                        std::vector<typename FieldType::value_type> deltas(permutation.columns());
+                        typename FieldType::value_type delta_power = FieldType::value_type::one();
+                        for (std::size_t i = 0; i < deltas.size(); i++) {
+                            deltas[i] = delta_power;
+                            delta_power *= delta;
+                        }
+
                         std::vector<math::polynomial_dfs<typename FieldType::value_type>> S_perm(permutation_size);
                         for (std::size_t i = 0; i < permutation_size; i++) {
                             S_perm[i] = math::polynomial_dfs<typename FieldType::value_type>(
                                 domain->size() - 1, domain->size(), FieldType::value_type::zero());
+                        }
 
-                            for (std::size_t j = 0; j < domain->size(); j++) {
-                                auto key = std::make_pair(i, j);
-                                S_perm[i][j] = delta.pow(permutation[key].first) * omega.pow(permutation[key].second);
-                            }
+                        // Every cell is written once, so the cells are filled in parallel across the columns
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t cell = 0; cell < permutation_size * domain->size(); cell++) {
+                            const std::size_t i = cell / domain->size();
+                            const std::size_t j = cell % domain->size();
+                            const std::size_t image = permutation(i, j);
+                            S_perm[i][j] = deltas[image / permutation.rows()] * omegas[image % permutation.rows()];
                         }
 
                         return S_perm;
@@ -423,12 +477,10 @@ namespace nil {
                         std::vector<math::polynomial_dfs<typename FieldType::value_type>> fixed_polys;
                         fixed_polys.insert( fixed_polys.end(), id_perm_polys.begin(), id_perm_polys.end() );
                         fixed_polys.insert( fixed_polys.end(), sigma_perm_polys.begin(), sigma_perm_polys.end() );
-                        for (std::size_t i = 0; i < public_table.constants().size(); i ++){
-                            fixed_polys.push_back(public_table.constants()[i]);
-                        }
-                        for (std::size_t i = 0; i < public_table.selectors().size(); i ++){
-                            fixed_polys.push_back(public_table.selectors()[i]);
-                        }
+                        fixed_polys.insert(fixed_polys.end(), public_table.constants().begin(),
+                                           public_table.constants().end());
+                        fixed_polys.insert(fixed_polys.end(), public_table.selectors().begin(),
+                                           public_table.selectors().end());
                         fixed_polys.push_back(q_last_q_blind[0]);
                         fixed_polys.push_back(q_last_q_blind[1]);
                         
@@ -451,7 +503,7 @@ namespace nil {
                     }
 
                     static inline preprocessed_data_type process(
-                        plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
+                        const plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
                             &constraint_system,
                         const typename policy_type::variable_assignment_type::public_table_type &public_assignment,
                         const plonk_table_description<FieldType, typename ParamsType::arithmetization_params>
@@ -556,6 +608,18 @@ namespace nil {
                         std::shared_ptr<math::evaluation_domain<FieldType>> basic_domain =
                             math::make_evaluation_domain<FieldType>(N_rows);
 
+                        return process(constraint_system, private_assignment, table_description, basic_domain);
+                    }
+
+                    // Reuses an existing domain, e.g. the one from the public preprocessed data of the circuit
+                    static inline preprocessed_data_type process(
+                        const plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
+                            &constraint_system,
+                        const typename policy_type::variable_assignment_type::private_table_type &private_assignment,
+                        const plonk_table_description<FieldType, typename ParamsType::arithmetization_params>
+                            &table_description,
+                        std::shared_ptr<math::evaluation_domain<FieldType>> basic_domain) {
+
                         plonk_private_polynomial_dfs_table<FieldType, typename ParamsType::arithmetization_params>
                             private_polynomial_table =
                                 plonk_private_polynomial_dfs_table<FieldType,
@@ -27,6 +27,18 @@
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_PROFILING_HPP
 
 #include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <time.h>
+#endif
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
@@ -36,15 +48,163 @@ namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace snark {
+                /**
+                 * @brief Per-stage measurements of a Placeholder prover or verifier run.
+                 *
+                 * Pass a profiler to placeholder_prover::process or placeholder_verifier::process to collect
+                 * them at runtime. Every stage records wall time and the CPU time of the calling thread in
+                 * milliseconds and the peak resident set size of the process in KiB. The CPU time leaves out
+                 * the work of other threads, such as the OpenMP workers of a stage or the other proofs of a
+                 * batch. With MULTICORE the wall time is the figure to compare between stages. Allocations are
+                 * counted only if allocations_counter is set, for example to a counter bumped by a replaced
+                 * operator new.
+                 */
+                class placeholder_profiler {
+                public:
+                    struct stage_type {
+                        std::string name;
+                        double wall_time;
+                        double cpu_time;
+                        std::size_t allocations;
+                        std::size_t peak_rss;
+                    };
+
+                    /**
+                     * Measures consecutive stages: every checkpoint closes the stage started by the previous
+                     * one. Does nothing when constructed with a null profiler.
+                     */
+                    class timer {
+                    public:
+                        timer(placeholder_profiler *profiler, const std::string &prefix) :
+                            _profiler(profiler), _prefix(prefix) {
+                            if (_profiler != nullptr) {
+                                restart();
+                            }
+                        }
+
+                        void checkpoint(const std::string &name) {
+                            if (_profiler == nullptr) {
+                                return;
+                            }
+                            std::size_t allocations = _profiler->allocations();
+                            _profiler->_stages.push_back(
+                                {_prefix + "." + name,
+                                 std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _wall)
+                                     .count(),
+                                 placeholder_profiler::thread_cpu_time() - _cpu, allocations - _allocations,
+                                 placeholder_profiler::peak_rss()});
+                            restart();
+                        }
+
+                    private:
+                        void restart() {
+                            _wall = std::chrono::steady_clock::now();
+                            _cpu = placeholder_profiler::thread_cpu_time();
+                            _allocations = _profiler->allocations();
+                        }
+
+                        placeholder_profiler *_profiler;
+                        std::string _prefix;
+                        std::chrono::steady_clock::time_point _wall;
+                        double _cpu;
+                        std::size_t _allocations;
+                    };
+
+                    std::function<std::size_t()> allocations_counter;
+
+                    const std::vector<stage_type> &stages() const {
+                        return _stages;
+                    }
+
+                    void clear() {
+                        _stages.clear();
+                    }
+
+                    void write_json(std::ostream &os) const {
+                        os << "{\"stages\":[";
+                        for (std::size_t i = 0; i < _stages.size(); i++) {
+                            os << (i ? "," : "") << "{\"name\":\"";
+                            write_json_string(os, _stages[i].name);
+                            os << "\",\"wall_time_ms\":" << _stages[i].wall_time
+                               << ",\"cpu_time_ms\":" << _stages[i].cpu_time
+                               << ",\"allocations\":" << _stages[i].allocations
+                               << ",\"peak_rss_kb\":" << _stages[i].peak_rss << "}";
+                        }
+                        os << "]}";
+                    }
+
+                    void write_csv(std::ostream &os) const {
+                        os << "name,wall_time_ms,cpu_time_ms,allocations,peak_rss_kb\n";
+                        for (const stage_type &stage : _stages) {
+                            os << stage.name << "," << stage.wall_time << "," << stage.cpu_time << ","
+                               << stage.allocations << "," << stage.peak_rss << "\n";
+                        }
+                    }
+
+                    // CPU time of the calling thread in milliseconds, 0 where there is no per-thread clock
+                    static double thread_cpu_time() {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+                        struct timespec time;
+                        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+                            return 0;
+                        }
+                        return 1000.0 * time.tv_sec + time.tv_nsec / 1000000.0;
+#else
+                        return 0;
+#endif
+                    }
+
+                    static std::size_t peak_rss() {
+#if defined(__unix__) || defined(__APPLE__)
+                        struct rusage usage;
+                        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+                            return 0;
+                        }
+#if defined(__APPLE__)
+                        return usage.ru_maxrss / 1024;
+#else
+                        return usage.ru_maxrss;
+#endif
+#else
+                        return 0;
+#endif
+                    }
+
+                private:
+                    // writes s with the quotes, backslashes and control characters escaped for a JSON string
+                    static void write_json_string(std::ostream &os, const std::string &s) {
+                        for (const char c : s) {
+                            if (c == '"' || c == '\\') {
+                                os << '\\' << c;
+                            } else if (static_cast<unsigned char>(c) < 0x20) {
+                                const std::ios::fmtflags flags = os.flags();
+                                const char fill = os.fill('0');
+                                os << "\\u" << std::hex << std::setw(4) << static_cast<int>(c);
+                                os.flags(flags);
+                                os.fill(fill);
+                            } else {
+                                os << c;
+                            }
+                        }
+                    }
+
+                    std::size_t allocations() const {
+                        return allocations_counter ? allocations_counter() : 0;
+                    }
+
+                    std::vector<stage_type> _stages;
+                };
+
                 template<typename PlaceholderParams>
                 struct placeholder_profiling;
 
                 template<typename FieldType, typename ArithmetizationParams, typename MerkleTreeHashType,
-                         typename TranscriptHashType, std::size_t Lambda, std::size_t R, std::size_t M>
+                         typename TranscriptHashType, std::size_t Lambda, std::size_t R, std::size_t M,
+                         typename TranscriptType>
                 struct placeholder_profiling<placeholder_params<FieldType, ArithmetizationParams, MerkleTreeHashType,
-                                                                TranscriptHashType, Lambda, R, M>> {
+                                                                TranscriptHashType, Lambda, R, M, TranscriptType>> {
                     typedef placeholder_params<FieldType, ArithmetizationParams, MerkleTreeHashType, TranscriptHashType,
-                                               Lambda, R, M>
+                                               Lambda, R, M, TranscriptType>
                         placeholder_params_type;
 
                     template<typename Proof, typename FRIParams, typename CommonData>
@@ -28,9 +28,11 @@
 #ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_PROVER_HPP
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_PROVER_HPP
 
-#include <chrono>
+#include <map>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 
@@ -43,6 +45,7 @@
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/gates_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/profiling.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -65,7 +68,7 @@ namespace nil {
                     }
                 }    // namespace detail
 
-                template<typename FieldType, typename ParamsType, typename ComponentType>
+                template<typename FieldType, typename ParamsType>
                 class placeholder_prover {
 
                     constexpr static const std::size_t witness_columns = ParamsType::witness_columns;
@@ -73,6 +76,7 @@ namespace nil {
                     constexpr static const std::size_t public_input_columns = ParamsType::public_input_columns;
                     using merkle_hash_type = typename ParamsType::merkle_hash_type;
                     using transcript_hash_type = typename ParamsType::transcript_hash_type;
+                    using transcript_type = typename ParamsType::transcript_type;
 
                     using policy_type = detail::placeholder_policy<FieldType, ParamsType>;
 
@@ -99,25 +103,82 @@ namespace nil {
 
                     static inline math::polynomial<typename FieldType::value_type> quotient_polynomial(
                         const typename public_preprocessor_type::preprocessed_data_type &preprocessed_public_data,
-                        const std::array<math::polynomial<typename FieldType::value_type>, f_parts> &F,
-                        transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> &transcript) {
+                        const std::array<math::polynomial_dfs<typename FieldType::value_type>, f_parts> &F,
+                        transcript_type &transcript) {
 
-                        // 7.1. Get $\alpha_0, \dots, \alpha_8 \in \mathbb{F}$ from $hash(\text{transcript})$
-                        std::array<typename FieldType::value_type, f_parts> alphas =
-                            transcript.template challenges<FieldType, f_parts>();
+                        typedef typename FieldType::value_type value_type;
 
-                        // 7.2. Compute F_consolidated
-                        math::polynomial<typename FieldType::value_type> F_consolidated = {0};
+                        // 7.1. Get $\alpha_0, \dots, \alpha_8 \in \mathbb{F}$ from $hash(\text{transcript})$
+                        std::array<value_type, f_parts> alphas = transcript.template challenges<FieldType, f_parts>();
+
+                        // 7.2. Compute F_consolidated. Parts evaluated on the same domain are combined pointwise,
+                        // so only one interpolation per distinct domain size is needed. The arguments evaluate
+                        // their parts on subgroups, which contain the roots of Z, so the parts are moved to the
+                        // coset of 7.3 through their coefficients rather than combined there directly
+                        const std::size_t n = preprocessed_public_data.common_data.basic_domain->m;
+                        std::size_t F_degree = n;
+                        std::map<std::size_t, math::polynomial_dfs<value_type>> F_combined;
                         for (std::size_t i = 0; i < f_parts; i++) {
                             if (F[i].size() == 0)
                                 continue;
-                            F_consolidated = F_consolidated + alphas[i] * F[i];
+                            F_degree = std::max(F_degree, F[i].degree());
+                            auto it = F_combined.find(F[i].size());
+                            if (it == F_combined.end()) {
+                                F_combined.emplace(F[i].size(), alphas[i] * F[i]);
+                            } else {
+                                it->second = it->second + alphas[i] * F[i];
+                            }
                         }
 
-                        math::polynomial<typename FieldType::value_type> T_consolidated =
-                            F_consolidated / preprocessed_public_data.common_data.Z;
+                        std::size_t extended_size = 1;
+                        while (extended_size < F_degree + 1) {
+                            extended_size <<= 1;
+                        }
+                        std::shared_ptr<math::evaluation_domain<FieldType>> extended_domain =
+                            math::make_evaluation_domain<FieldType>(extended_size);
+
+                        std::vector<value_type> F_consolidated(extended_size, value_type::zero());
+                        for (const auto &part : F_combined) {
+                            std::vector<value_type> coefficients = part.second.coefficients();
+                            std::size_t count = std::min(coefficients.size(), extended_size);
+                            for (std::size_t j = 0; j < count; j++) {
+                                F_consolidated[j] += coefficients[j];
+                            }
+                        }
 
-                        return T_consolidated;
+                        // 7.3. Divide by Z(X) = X^n - 1 on the coset delta * <omega_N>, where Z does not vanish.
+                        // Z(delta * omega_N^j) = delta^n * omega_N^{jn} - 1 repeats with period N / n,
+                        // so only N / n inverses are needed
+                        const value_type delta = ParamsType::delta;
+                        value_type shift = value_type::one();
+                        for (std::size_t j = 0; j < extended_size; j++) {
+                            F_consolidated[j] *= shift;
+                            shift *= delta;
+                        }
+                        extended_domain->fft(F_consolidated);
+
+                        const std::size_t Z_period = extended_size / n;
+                        const value_type delta_n = delta.pow(n);
+                        std::vector<value_type> Z_inversed(Z_period);
+                        for (std::size_t j = 0; j < Z_period; j++) {
+                            Z_inversed[j] =
+                                (delta_n * extended_domain->get_domain_element(j * n) - value_type::one()).inversed();
+                        }
+                        for (std::size_t j = 0; j < extended_size; j++) {
+                            F_consolidated[j] *= Z_inversed[j % Z_period];
+                        }
+
+                        // 7.4. Interpolate T back to the coefficient form, undoing the coset shift
+                        extended_domain->inverse_fft(F_consolidated);
+                        const value_type delta_inversed = delta.inversed();
+                        shift = value_type::one();
+                        for (std::size_t j = 0; j < extended_size; j++) {
+                            F_consolidated[j] *= shift;
+                            shift *= delta_inversed;
+                        }
+                        F_consolidated.resize(F_degree - n + 1);
+
+                        return math::polynomial<value_type>(F_consolidated);
                     }
 
                 public:
@@ -126,19 +187,20 @@ namespace nil {
                         const typename private_preprocessor_type::preprocessed_data_type &preprocessed_private_data,
                         const plonk_table_description<FieldType, typename ParamsType::arithmetization_params>
                             &table_description,
-                        plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
+                        const plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
                             &constraint_system,
                         const typename policy_type::variable_assignment_type &assignments,
                         const typename ParamsType::commitment_params_type
-                            &fri_params) {    // TODO: fri_type are the same for each lpc_type here
+                            &fri_params,    // TODO: fri_type are the same for each lpc_type here
+                        placeholder_profiler *profiler = nullptr) {
 
 #ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        auto begin = std::chrono::high_resolution_clock::now();
-                        auto last = begin;
-                        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "Placeholder prover:" << std::endl;
+                        placeholder_profiler default_profiler;
+                        if (profiler == nullptr) {
+                            profiler = &default_profiler;
+                        }
 #endif
+                        placeholder_profiler::timer timer(profiler, "placeholder_prover");
                         placeholder_proof<FieldType, ParamsType> proof;
 
                         plonk_polynomial_dfs_table<FieldType, typename ParamsType::arithmetization_params>
@@ -146,51 +208,35 @@ namespace nil {
                                 plonk_polynomial_dfs_table<FieldType, typename ParamsType::arithmetization_params>(
                                     preprocessed_private_data.private_polynomial_table,
                                     preprocessed_public_data.public_polynomial_table);
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "polynomial_table_generated_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("polynomial_table");
                         // 1. Add circuit definition to transcript
                         // transcript(short_description); //TODO: circuit_short_description marshalling
                         std::vector<std::uint8_t> transcript_init {};
-                        transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(transcript_init);
+                        transcript_type transcript(transcript_init);
 
                         // 2. Commit witness columns and public_input columns
 
                         std::vector<math::polynomial_dfs<typename FieldType::value_type>> variable_polys;
 
-                        for (std::size_t i = 0; i < preprocessed_private_data.private_polynomial_table.witnesses().size(); i++){
-                            variable_polys.push_back(preprocessed_private_data.private_polynomial_table.witnesses()[i]);
-                        }
+                        const auto &witnesses = polynomial_table.private_table().witnesses();
+                        const auto &public_inputs = polynomial_table.public_table().public_inputs();
+                        variable_polys.reserve(witnesses.size() + public_inputs.size());
+                        variable_polys.insert(variable_polys.end(), witnesses.begin(), witnesses.end());
+                        variable_polys.insert(variable_polys.end(), public_inputs.begin(), public_inputs.end());
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        last = std::chrono::high_resolution_clock::now();
-#endif
-                        for (std::size_t i = 0; i < preprocessed_public_data.public_polynomial_table.public_inputs().size(); i ++){
-                            variable_polys.push_back(preprocessed_public_data.public_polynomial_table.public_inputs()[i]);
-                        }
+                        // Leaves of the witness and quotient commitments share one buffer
+                        typename variable_values_commitment_scheme_type::leaves_buffer_type precommitment_leaves;
 
                         typename variable_values_commitment_scheme_type::precommitment_type variable_values_precommitment =
                             algorithms::precommit<variable_values_commitment_scheme_type>(variable_polys, fri_params.D[0],
-                                                                                          fri_params.step_list.front());
+                                                                                          fri_params.step_list.front(),
+                                                                                          precommitment_leaves);
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "witness_precommit_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("witness_precommit");
                         proof.variable_values_commitment =
                             algorithms::commit<variable_values_commitment_scheme_type>(variable_values_precommitment);
                         transcript(proof.variable_values_commitment);
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        last = std::chrono::high_resolution_clock::now();
-#endif
                         // 4. permutation_argument
                         auto permutation_argument = placeholder_permutation_argument<FieldType, ParamsType>::prove_eval(
                             constraint_system,
@@ -199,16 +245,10 @@ namespace nil {
                             polynomial_table,
                             fri_params,
                             transcript);
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "permutation_argument_prove_eval_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("permutation_argument");
                         proof.v_perm_commitment = permutation_argument.permutation_poly_precommitment.root();
 
-                        std::array<math::polynomial<typename FieldType::value_type>, f_parts> F;
+                        std::array<math::polynomial_dfs<typename FieldType::value_type>, f_parts> F;
 
                         F[0] = permutation_argument.F[0];
                         F[1] = permutation_argument.F[1];
@@ -230,7 +270,9 @@ namespace nil {
                         } else {
 
                             for (std::size_t i = 0; i < lookup_argument.F.size(); i++) {
-                                lookup_argument.F[i] = {0};
+                                lookup_argument.F[i] = math::polynomial_dfs<typename FieldType::value_type>(
+                                    0, preprocessed_public_data.common_data.basic_domain->m,
+                                    FieldType::value_type::zero());
                             }
                         }
 
@@ -244,20 +286,13 @@ namespace nil {
                             proof.value_perm_commitment = lookup_argument.value_precommitment.root();
                             proof.v_l_perm_commitment = lookup_argument.V_L_precommitment.root();
                         }
+                        timer.checkpoint("lookup_argument");
+
                         // 6. circuit-satisfability
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        last = std::chrono::high_resolution_clock::now();
-#endif
-                        F[8] = placeholder_gates_argument<FieldType, ParamsType, ComponentType>::prove_eval(
+                        F[8] = placeholder_gates_argument<FieldType, ParamsType>::prove_eval(
                             constraint_system, polynomial_table, preprocessed_public_data.common_data.basic_domain,
                             transcript)[0];
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "gate_argument_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("gates_argument");
                         /////TEST
 #ifdef ZK_PLACEHOLDER_DEBUG_ENABLED
                         for (std::size_t i = 0; i < f_parts; i++) {
@@ -289,43 +324,23 @@ namespace nil {
                         }
 #endif
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        last = std::chrono::high_resolution_clock::now();
-#endif
                         ///// TODO Bug is here
                         // 7. Aggregate quotient polynomial
                         math::polynomial<typename FieldType::value_type> T =
                             quotient_polynomial(preprocessed_public_data, F, transcript);
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "quotient_polynomial_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("quotient_polynomial");
 
                         std::vector<math::polynomial<typename FieldType::value_type>> T_splitted =
                             detail::split_polynomial<FieldType>(T, fri_params.max_degree);
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "split_polynomial_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("split_polynomial");
                         typename runtime_size_commitment_scheme_type::precommitment_type T_precommitment =
                             algorithms::precommit<runtime_size_commitment_scheme_type>(T_splitted, fri_params.D[0],
-                                                                                       fri_params.step_list.front());
+                                                                                       fri_params.step_list.front(),
+                                                                                       precommitment_leaves);
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "T_splitted_precommit_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("quotient_precommit");
                         proof.T_commitment = algorithms::commit<runtime_size_commitment_scheme_type>(T_precommitment);
                         transcript(proof.T_commitment);
 
@@ -356,24 +371,12 @@ namespace nil {
                         for (std::size_t i = witness_columns; i < witness_columns + public_input_columns; i ++) {
                             variable_values_evaluation_points[i].push_back(challenge);
                         }
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "witness_evaluation_points_generated_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("evaluation_points");
 
                         proof.eval_proof.variable_values = algorithms::proof_eval<variable_values_commitment_scheme_type>(
                             variable_values_evaluation_points, variable_values_precommitment,
                             variable_polys, fri_params, transcript);
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "variable_values proof_eval, time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("variable_values_proof_eval");
                         // permutation polynomial evaluation
                         std::vector<typename FieldType::value_type> evaluation_points_v_p = {challenge,
                                                                                              challenge * omega};
@@ -383,13 +386,7 @@ namespace nil {
                             permutation_argument.permutation_polynomial,
                             fri_params,
                             transcript);
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "permutation_proof_eval_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("permutation_proof_eval");
 
                         // lookup polynomials evaluation
                         if (is_lookup_enabled) {
@@ -404,13 +401,7 @@ namespace nil {
                                     transcript);
                             proof.eval_proof.lookups.push_back(v_l_evaluation);
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                            elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                                std::chrono::high_resolution_clock::now() - last);
-                            std::cout << "v_l_evaluation proof_eval, time: " << std::fixed << std::setprecision(3)
-                                      << elapsed.count() * 1e-6 << "ms" << std::endl;
-                            last = std::chrono::high_resolution_clock::now();
-#endif
+                            timer.checkpoint("lookup_v_l_proof_eval");
                             std::vector<typename FieldType::value_type> evaluation_points_input = {
                                 challenge, challenge * omega.inversed()};
                             typename permutation_commitment_scheme_type::proof_type input_evaluation =
@@ -422,13 +413,7 @@ namespace nil {
                                     transcript);
                             proof.eval_proof.lookups.push_back(input_evaluation);
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                            elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                                std::chrono::high_resolution_clock::now() - last);
-                            std::cout << "input_evaluation proof_eval, time: " << std::fixed << std::setprecision(3)
-                                      << elapsed.count() * 1e-6 << "ms" << std::endl;
-                            last = std::chrono::high_resolution_clock::now();
-#endif
+                            timer.checkpoint("lookup_input_proof_eval");
                             std::vector<typename FieldType::value_type> evaluation_points_value = {challenge};
                             typename permutation_commitment_scheme_type::proof_type value_evaluation =
                                 algorithms::proof_eval<permutation_commitment_scheme_type>(
@@ -439,13 +424,12 @@ namespace nil {
                                     transcript);
                             proof.eval_proof.lookups.push_back(value_evaluation);
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                            elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                                std::chrono::high_resolution_clock::now() - last);
-                            std::cout << "value_evaluation proof_eval, time: " << std::fixed << std::setprecision(3)
-                                      << elapsed.count() * 1e-6 << "ms" << std::endl;
-                            last = std::chrono::high_resolution_clock::now();
-#endif
+                            timer.checkpoint("lookup_value_proof_eval");
+                        } else {
+                            // Keep the same stages with and without lookups
+                            timer.checkpoint("lookup_v_l_proof_eval");
+                            timer.checkpoint("lookup_input_proof_eval");
+                            timer.checkpoint("lookup_value_proof_eval");
                         }
 
                         // quotient
@@ -453,13 +437,7 @@ namespace nil {
                         proof.eval_proof.quotient = algorithms::proof_eval<runtime_size_commitment_scheme_type>(
                             {challenge}, T_precommitment, T_splitted, fri_params, transcript);
 
-#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        std::cout << "quotient_proof_eval_time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
-                        last = std::chrono::high_resolution_clock::now();
-#endif
+                        timer.checkpoint("quotient_proof_eval");
                         // public
                         std::vector<typename FieldType::value_type> &evaluation_points_public =
                             evaluation_points_quotient;
@@ -468,12 +446,10 @@ namespace nil {
                         fixed_polys.insert( fixed_polys.end(), preprocessed_public_data.identity_polynomials.begin(), preprocessed_public_data.identity_polynomials.end() );
                         fixed_polys.insert( fixed_polys.end(), preprocessed_public_data.permutation_polynomials.begin(), preprocessed_public_data.permutation_polynomials.end() );
                         
-                        for (std::size_t i = 0; i < preprocessed_public_data.public_polynomial_table.constants().size(); i ++){
-                            fixed_polys.push_back(preprocessed_public_data.public_polynomial_table.constants()[i]);
-                        }
-                        for (std::size_t i = 0; i < preprocessed_public_data.public_polynomial_table.selectors().size(); i ++){
-                            fixed_polys.push_back(preprocessed_public_data.public_polynomial_table.selectors()[i]);
-                        }
+                        const auto &constants = preprocessed_public_data.public_polynomial_table.constants();
+                        const auto &selectors = preprocessed_public_data.public_polynomial_table.selectors();
+                        fixed_polys.insert(fixed_polys.end(), constants.begin(), constants.end());
+                        fixed_polys.insert(fixed_polys.end(), selectors.begin(), selectors.end());
                         
                         fixed_polys.push_back(preprocessed_public_data.q_last);
                         fixed_polys.push_back(preprocessed_public_data.q_blind);
@@ -482,24 +458,13 @@ namespace nil {
                             evaluation_points_public, preprocessed_public_data.precommitments.fixed_values,
                             fixed_polys, fri_params, transcript);
 
-                        /*#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                                                                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                                                                            std::chrono::high_resolution_clock::now() - last);
-                                                                        std::cout << "fixed_values_proof_eval_time: " << std::fixed << std::setprecision(3)
-                                                                                << elapsed.count() * 1e-6 << "ms" << std::endl;
-                                                                        last = std::chrono::high_resolution_clock::now();
-                        #endif*/
+                        timer.checkpoint("fixed_values_proof_eval");
 
 #ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - last);
-                        last = std::chrono::high_resolution_clock::now();
-                        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                            std::chrono::high_resolution_clock::now() - begin);
-                        std::cout << "Placeholder prover, total time: " << std::fixed << std::setprecision(3)
-                                  << elapsed.count() * 1e-6 << "ms" << std::endl;
+                        if (profiler == &default_profiler) {
+                            default_profiler.write_csv(std::cout);
+                        }
 #endif
-
                         return proof;
                     }
                 };
@@ -0,0 +1,161 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_VERIFICATION_KEY_HPP
+#define CRYPTO3_ZK_PLONK_PLACEHOLDER_VERIFICATION_KEY_HPP
+
+#include <memory>
+#include <vector>
+
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/grand_product.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+
+                /*!
+                 * @brief Part of the preprocessed public data the Placeholder verifier needs.
+                 *
+                 * It holds the fixed values commitment, the columns rotations and the domain parameters, so
+                 * its size does not depend on the number of rows, and the evaluation layout of the opened
+                 * columns, shared by all the proofs of the circuit. The fixed columns are read from the
+                 * fixed_values opening of the proof, and Z, lagrange_0, q_last and q_blind are evaluated
+                 * in closed form instead of from their dfs representation.
+                 */
+                template<typename FieldType, typename ParamsType>
+                struct placeholder_verification_key {
+                    typedef FieldType field_type;
+                    typedef typename FieldType::value_type value_type;
+
+                    typedef typename placeholder_public_preprocessor<FieldType, ParamsType>::preprocessed_data_type
+                        preprocessed_data_type;
+                    typedef typename preprocessed_data_type::public_commitments_type commitments_type;
+                    typedef typename preprocessed_data_type::common_data_type::columns_rotations_type
+                        columns_rotations_type;
+                    typedef typename detail::placeholder_policy<FieldType, ParamsType>::evaluation_layout
+                        evaluation_layout_type;
+
+                    // The evaluations of the public polynomials at a challenge
+                    struct evaluations_type {
+                        value_type Z;
+                        value_type lagrange_0;
+                        value_type q_last;
+                        value_type q_blind;
+                    };
+
+                    commitments_type commitments;
+                    columns_rotations_type columns_rotations;
+                    std::size_t rows_amount;
+                    std::size_t usable_rows_amount;
+                    value_type omega;
+                    std::shared_ptr<const evaluation_layout_type> evaluation_layout;
+
+                    placeholder_verification_key(const commitments_type &commitments,
+                                                 const columns_rotations_type &columns_rotations,
+                                                 std::size_t rows_amount, std::size_t usable_rows_amount,
+                                                 const value_type &omega) :
+                        commitments(commitments),
+                        columns_rotations(columns_rotations), rows_amount(rows_amount),
+                        usable_rows_amount(usable_rows_amount), omega(omega),
+                        evaluation_layout(std::make_shared<const evaluation_layout_type>(
+                            columns_rotations, ParamsType::witness_columns, ParamsType::public_input_columns,
+                            ParamsType::constant_columns)) {
+                    }
+
+                    explicit placeholder_verification_key(const preprocessed_data_type &preprocessed_data) :
+                        placeholder_verification_key(preprocessed_data.common_data.commitments,
+                                                     preprocessed_data.common_data.columns_rotations,
+                                                     preprocessed_data.common_data.rows_amount,
+                                                     preprocessed_data.common_data.usable_rows_amount,
+                                                     preprocessed_data.common_data.basic_domain
+                                                         ->get_domain_element(1)) {
+                    }
+
+                    /*
+                     * On a domain of size n the Lagrange polynomial of the row j is
+                     * L_j(y) = omega^j * (y^n - 1) / (n * (y - omega^j)).
+                     * lagrange_0 and q_last are the Lagrange polynomials of the row usable_rows_amount, like the
+                     * ones of the preprocessor, q_blind is the sum of the ones of the rows after it.
+                     */
+                    evaluations_type evaluate(const value_type &y) const {
+                        evaluations_type result;
+                        result.Z = y.pow(rows_amount) - value_type::one();
+
+                        const std::size_t first_blind_row = usable_rows_amount + 1;
+                        const std::size_t blind_rows =
+                            rows_amount > first_blind_row ? rows_amount - first_blind_row : 0;
+
+                        // omegas[0] is the point of the row usable_rows_amount, the others the blinded rows
+                        std::vector<value_type> omegas(blind_rows + 1);
+                        omegas[0] = omega.pow(usable_rows_amount);
+                        for (std::size_t i = 1; i < omegas.size(); i++) {
+                            omegas[i] = omegas[i - 1] * omega;
+                        }
+
+                        std::vector<value_type> lagrange(omegas.size());
+                        if (result.Z == value_type::zero()) {
+                            // The challenge is a point of the domain
+                            for (std::size_t i = 0; i < omegas.size(); i++) {
+                                lagrange[i] = y == omegas[i] ? value_type::one() : value_type::zero();
+                            }
+                        } else {
+                            for (std::size_t i = 0; i < omegas.size(); i++) {
+                                lagrange[i] = y - omegas[i];
+                            }
+                            detail::batch_inversion<FieldType>(lagrange);
+
+                            const value_type scale = result.Z * value_type(rows_amount).inversed();
+                            for (std::size_t i = 0; i < omegas.size(); i++) {
+                                lagrange[i] *= scale * omegas[i];
+                            }
+                        }
+
+                        result.lagrange_0 = lagrange[0];
+                        result.q_last = lagrange[0];
+                        result.q_blind = value_type::zero();
+                        for (std::size_t i = 1; i < lagrange.size(); i++) {
+                            result.q_blind += lagrange[i];
+                        }
+
+                        return result;
+                    }
+
+                    // Evaluations of the dfs representation, for the data of the prover
+                    static evaluations_type evaluate(const preprocessed_data_type &preprocessed_data,
+                                                     const value_type &y) {
+                        return {preprocessed_data.common_data.Z.evaluate(y),
+                                preprocessed_data.common_data.lagrange_0.evaluate(y),
+                                preprocessed_data.q_last.evaluate(y), preprocessed_data.q_blind.evaluate(y)};
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_PLACEHOLDER_VERIFICATION_KEY_HPP
@@ -36,12 +36,14 @@
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/permutation_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/verification_key.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/profiling.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace snark {
-                template<typename FieldType, typename ParamsType, typename ComponentType>
+                template<typename FieldType, typename ParamsType>
                 class placeholder_verifier {
 
                     constexpr static const std::size_t witness_columns = ParamsType::witness_columns;
@@ -51,6 +53,7 @@ namespace nil {
 
                     using merkle_hash_type = typename ParamsType::merkle_hash_type;
                     using transcript_hash_type = typename ParamsType::transcript_hash_type;
+                    using transcript_type = typename ParamsType::transcript_type;
 
                     using policy_type = detail::placeholder_policy<FieldType, ParamsType>;
 
@@ -67,6 +70,7 @@ namespace nil {
                     using quotient_commitment_scheme_type = typename ParamsType::quotient_commitment_scheme_type;
 
                     using public_preprocessor_type = placeholder_public_preprocessor<FieldType, ParamsType>;
+                    using verification_key_type = placeholder_verification_key<FieldType, ParamsType>;
 
                     constexpr static const std::size_t gate_parts = 1;
                     constexpr static const std::size_t permutation_parts = 3;
@@ -79,116 +83,85 @@ namespace nil {
                         placeholder_proof<FieldType, ParamsType> &proof,
                         plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
                             &constraint_system,
-                        const typename ParamsType::commitment_params_type &fri_params) {
+                        const typename ParamsType::commitment_params_type &fri_params,
+                        placeholder_profiler *profiler = nullptr) {
+                        return process(verification_key_type(preprocessed_public_data), proof, constraint_system,
+                                       fri_params, profiler);
+                    }
+
+                    static inline bool process(
+                        const verification_key_type &verification_key,
+                        placeholder_proof<FieldType, ParamsType> &proof,
+                        plonk_constraint_system<FieldType, typename ParamsType::arithmetization_params>
+                            &constraint_system,
+                        const typename ParamsType::commitment_params_type &fri_params,
+                        placeholder_profiler *profiler = nullptr) {
+
+                        placeholder_profiler::timer timer(profiler, "placeholder_verifier");
 
                         // 1. Add circuit definition to transcript
                         // transcript(short_description);
                         std::vector<std::uint8_t> transcript_init {};
-                        transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(transcript_init);
+                        transcript_type transcript(transcript_init);
 
                         // 3. append witness commitments to transcript
                         transcript(proof.variable_values_commitment);
 
                         // 4. prepare evaluaitons of the polynomials that are copy-constrained
                         std::size_t permutation_size = (proof.eval_proof.fixed_values.z.size() - 2 - constant_columns - selector_columns) / 2;
-                        std::vector<typename FieldType::value_type> f(permutation_size);
-
-                        for (std::size_t i = 0; i < permutation_size; i++) {
-                            std::size_t zero_index = 0;
-                            for (std::size_t j = 0;
-                                 j < preprocessed_public_data.common_data.columns_rotations[i].size();
-                                 j++) {
 
-                                if (preprocessed_public_data.common_data.columns_rotations[i][j] == 0) {
-                                    zero_index = j;
-                                }
+                        // The openings come column by column, in the order of the slots of the evaluation layout
+                        typename policy_type::evaluation_map columns_at_y(verification_key.evaluation_layout);
+                        std::vector<typename FieldType::value_type> &values_at_y = columns_at_y.values();
+                        std::size_t slot = 0;
+                        for (std::size_t i = 0; i < witness_columns + public_input_columns; i++) {
+                            for (std::size_t j = 0; j < verification_key.columns_rotations[i].size(); j++) {
+                                values_at_y[slot++] = proof.eval_proof.variable_values.z[i][j];
                             }
-                            if (i < witness_columns + public_input_columns) {
-                                f[i] = proof.eval_proof.variable_values.z[i][zero_index];
-                            } else if (i < witness_columns + public_input_columns + constant_columns) {
-                                std::size_t idx = i - witness_columns - public_input_columns + permutation_size*2;
-                                f[i] = proof.eval_proof.fixed_values.z[idx][zero_index];
-                            }
-                        }
-
-                        // 5. permutation argument
-                        if (preprocessed_public_data.common_data.lagrange_0.evaluate(proof.eval_proof.challenge) !=
-                            proof.eval_proof.lagrange_0) {
-                            return false;
                         }
-                        std::array<typename FieldType::value_type, permutation_parts> permutation_argument =
-                            placeholder_permutation_argument<FieldType, ParamsType>::verify_eval(
-                                preprocessed_public_data, proof.eval_proof.challenge, f,
-                                proof.eval_proof.permutation.z[0][0], proof.eval_proof.permutation.z[0][1],
-                                proof.v_perm_commitment, transcript);
-
-                        typename policy_type::evaluation_map columns_at_y;
-                        for (std::size_t i = 0; i < witness_columns; i++) {
-
-                            std::size_t i_global_index = i;
-
-                            for (std::size_t j = 0;
-                                 j < preprocessed_public_data.common_data.columns_rotations[i_global_index].size();
+                        for (std::size_t i = 0; i < constant_columns + selector_columns; i++) {
+                            const std::size_t i_global_index = witness_columns + public_input_columns + i;
+                            for (std::size_t j = 0; j < verification_key.columns_rotations[i_global_index].size();
                                  j++) {
-
-                                auto key = std::make_tuple(
-                                    i,
-                                    preprocessed_public_data.common_data.columns_rotations[i_global_index][j],
-                                    plonk_variable<FieldType>::column_type::witness);
-                                columns_at_y[key] = proof.eval_proof.variable_values.z[i][j];
+                                values_at_y[slot++] = proof.eval_proof.fixed_values.z[i + permutation_size * 2][j];
                             }
                         }
-                        for (std::size_t i = 0; i < 0 + public_input_columns; i++) {
-                            std::size_t i_global_index = witness_columns + i;
+                        BOOST_ASSERT(slot == values_at_y.size());
+                        timer.checkpoint("evaluation_map");
 
-                            for (std::size_t j = 0;
-                                 j < preprocessed_public_data.common_data.columns_rotations[i_global_index].size();
-                                 j++) {
-
-                                auto key = std::make_tuple(
-                                    i,
-                                    preprocessed_public_data.common_data.columns_rotations[i_global_index][j],
-                                    plonk_variable<FieldType>::column_type::public_input);
-                                columns_at_y[key] = proof.eval_proof.variable_values.z[witness_columns + i][j];
-                            }
+                        std::vector<typename FieldType::value_type> f(permutation_size);
+                        for (std::size_t i = 0; i < permutation_size; i++) {
+                            f[i] = values_at_y[columns_at_y.layout().slot(i, 0)];
                         }
-                        for (std::size_t i = 0; i < 0 + constant_columns; i++) {
-                            std::size_t i_global_index = witness_columns + public_input_columns + i;
-                            for (std::size_t j = 0;
-                                 j < preprocessed_public_data.common_data.columns_rotations[i_global_index].size();
-                                 j++) {
 
-                                auto key = std::make_tuple(
-                                    i,
-                                    preprocessed_public_data.common_data.columns_rotations[i_global_index][j],
-                                    plonk_variable<FieldType>::column_type::constant);
-                                columns_at_y[key] = proof.eval_proof.fixed_values.z[i + permutation_size*2][j];
-                            }
+                        // 5. permutation argument
+                        const typename verification_key_type::evaluations_type public_values =
+                            verification_key.evaluate(proof.eval_proof.challenge);
+                        if (public_values.lagrange_0 != proof.eval_proof.lagrange_0) {
+                            return false;
                         }
 
-                        for (std::size_t i = 0; i < selector_columns; i++) {
-                            std::size_t i_global_index = witness_columns + constant_columns + public_input_columns + i;
-
-                            for (std::size_t j = 0;
-                                 j < preprocessed_public_data.common_data.columns_rotations[i_global_index].size();
-                                 j++) {
-
-                                auto key = std::make_tuple(
-                                    i,
-                                    preprocessed_public_data.common_data.columns_rotations[i_global_index][j],
-                                    plonk_variable<FieldType>::column_type::selector);
-                                columns_at_y[key] = proof.eval_proof.fixed_values.z[i + permutation_size*2 + constant_columns][j];
-                            }
+                        // S_id and S_sigma come first in the fixed values opening
+                        std::vector<typename FieldType::value_type> S_id_values(permutation_size);
+                        std::vector<typename FieldType::value_type> S_sigma_values(permutation_size);
+                        for (std::size_t i = 0; i < permutation_size; i++) {
+                            S_id_values[i] = proof.eval_proof.fixed_values.z[i][0];
+                            S_sigma_values[i] = proof.eval_proof.fixed_values.z[permutation_size + i][0];
                         }
 
+                        std::array<typename FieldType::value_type, permutation_parts> permutation_argument =
+                            placeholder_permutation_argument<FieldType, ParamsType>::verify_eval(
+                                public_values, f, S_id_values, S_sigma_values, proof.eval_proof.permutation.z[0][0],
+                                proof.eval_proof.permutation.z[0][1], proof.v_perm_commitment, transcript);
+                        timer.checkpoint("permutation_argument");
+
                         // 6. lookup argument
                         bool use_lookup = constraint_system.lookup_gates().size() > 0;
                         std::array<typename FieldType::value_type, lookup_parts> lookup_argument;
                         if (use_lookup) {
                             lookup_argument = placeholder_lookup_argument<
                                 FieldType, permutation_commitment_scheme_type,
-                                ParamsType>::verify_eval(preprocessed_public_data, constraint_system.lookup_gates(),
-                                                         proof.eval_proof.challenge, columns_at_y,
+                                ParamsType>::verify_eval(public_values, constraint_system.lookup_gates(), columns_at_y,
                                                          proof.eval_proof.lookups[1].z[0][0],
                                                          proof.eval_proof.lookups[1].z[0][1],
                                                          proof.eval_proof.lookups[2].z[0][0],
@@ -202,10 +175,13 @@ namespace nil {
                             }
                         }
 
+                        timer.checkpoint("lookup_argument");
+
                         // 7. gate argument
                         std::array<typename FieldType::value_type, 1> gate_argument =
-                            placeholder_gates_argument<FieldType, ParamsType, ComponentType>::verify_eval(
+                            placeholder_gates_argument<FieldType, ParamsType>::verify_eval(
                                 constraint_system.gates(), columns_at_y, proof.eval_proof.challenge, transcript);
+                        timer.checkpoint("gates_argument");
 
                         // 8. alphas computations
                         std::array<typename FieldType::value_type, f_parts> alphas =
@@ -220,8 +196,7 @@ namespace nil {
                             return false;
                         }
 
-                        typename FieldType::value_type omega =
-                            preprocessed_public_data.common_data.basic_domain->get_domain_element(1);
+                        const typename FieldType::value_type &omega = verification_key.omega;
 
                         std::array<std::vector<typename FieldType::value_type>, witness_columns + public_input_columns>
                             variable_values_evaluation_points;
@@ -230,7 +205,7 @@ namespace nil {
                         for (std::size_t variable_values_index = 0; variable_values_index < witness_columns; variable_values_index++) {
 
                             std::vector<int> variable_values_rotation =
-                                preprocessed_public_data.common_data.columns_rotations[variable_values_index];
+                                verification_key.columns_rotations[variable_values_index];
 
                             for (std::size_t rotation_index = 0; rotation_index < variable_values_rotation.size();
                                  rotation_index++) {
@@ -246,6 +221,7 @@ namespace nil {
                                 fri_params, transcript)) {
                             return false;
                         }
+                        timer.checkpoint("variable_values_verify_eval");
 
                         // permutation
                         std::vector<typename FieldType::value_type> evaluation_points_permutation = {challenge,
@@ -257,6 +233,8 @@ namespace nil {
                                                                                          transcript)) {
                             return false;
                         }
+                        timer.checkpoint("permutation_verify_eval");
+
                         // lookup
                         if (use_lookup) {
                             // TODO: Check if commitments roots are used correctly.
@@ -294,6 +272,7 @@ namespace nil {
                                 return false;
                             }
                         }
+                        timer.checkpoint("lookup_verify_eval");
 
                         // quotient
                         std::vector<typename FieldType::value_type> evaluation_points_quotient = {challenge};
@@ -304,6 +283,7 @@ namespace nil {
                                                                                           transcript)) {
                             return false;
                         }
+                        timer.checkpoint("quotient_verify_eval");
 
                         // public data
                         std::vector<typename FieldType::value_type> &evaluation_points_public =
@@ -312,11 +292,12 @@ namespace nil {
                         if (!algorithms::verify_eval<fixed_values_commitment_scheme_type>(
                                 evaluation_points_public,
                                 proof.eval_proof.fixed_values,
-                                preprocessed_public_data.common_data.commitments.fixed_values,
+                                verification_key.commitments.fixed_values,
                                 fri_params,
                                 transcript)) {
                             return false;
                         }
+                        timer.checkpoint("fixed_values_verify_eval");
 
                         // 10. final check
                         std::array<typename FieldType::value_type, f_parts> F;
@@ -342,13 +323,10 @@ namespace nil {
                         }
 
                         // Z is polynomial -1, 0 ...., 0, 1
-                        typename FieldType::value_type Z_at_challenge = preprocessed_public_data.common_data.Z.evaluate(challenge);
-                        
-                        if (F_consolidated != Z_at_challenge * T_consolidated) {
-                            return false;
-                        }
+                        bool result = F_consolidated == public_values.Z * T_consolidated;
+                        timer.checkpoint("final_check");
 
-                        return true;
+                        return result;
                     }
                 };
             }    // namespace snark
@@ -0,0 +1,212 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_R1CS_GG_PPZKSNARK_FIXED_BASE_MULTIEXP_HPP
+#define CRYPTO3_R1CS_GG_PPZKSNARK_FIXED_BASE_MULTIEXP_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+                    /**
+                     * Precomputed table for multiexps over a fixed set of bases.
+                     *
+                     * Scalars are split into stripes of stripe_bits bits, and the table holds every base
+                     * shifted to the beginning of every stripe: 2^(s * stripe_bits) * P_i. A multiexp is
+                     * then a bucket multiexp over all stripes at once with stripe_bits-bit scalars. Every
+                     * bucket window is shared by all the stripes, so doublings and bucket reductions drop
+                     * by the number of stripes. The table costs the number of stripes times the memory of
+                     * the bases.
+                     */
+                    template<typename GroupType, typename FieldType>
+                    class fixed_base_multiexp_table {
+                        typedef typename FieldType::integral_type integral_type;
+
+                    public:
+                        typedef typename GroupType::value_type group_value_type;
+
+                        constexpr static const std::size_t scalar_bits = FieldType::modulus_bits;
+                        // Shorter stripes do not pay off
+                        constexpr static const std::size_t min_stripe_bits = 8;
+                        constexpr static const std::size_t max_stripes =
+                            (scalar_bits + min_stripe_bits - 1) / min_stripe_bits;
+
+                        fixed_base_multiexp_table() : bases_amount(0), stripes(1), stripe_bits(scalar_bits) {
+                        }
+
+                        template<typename InputBaseIterator>
+                        fixed_base_multiexp_table(InputBaseIterator first, InputBaseIterator last,
+                                                  std::size_t stripes_amount) :
+                            bases_amount(std::distance(first, last)),
+                            stripes(std::max(std::size_t(1), std::min(stripes_amount, max_stripes))),
+                            stripe_bits((scalar_bits + stripes - 1) / stripes), table(bases_amount * stripes) {
+                            std::copy(first, last, table.begin());
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < bases_amount; ++i) {
+                                for (std::size_t s = 1; s < stripes; ++s) {
+                                    group_value_type shifted = table[(s - 1) * bases_amount + i];
+                                    for (std::size_t j = 0; j < stripe_bits; ++j) {
+                                        shifted = shifted.doubled();
+                                    }
+                                    table[s * bases_amount + i] = shifted;
+                                }
+                            }
+                        }
+
+                        std::size_t size() const {
+                            return bases_amount;
+                        }
+
+                        std::size_t stripes_amount() const {
+                            return stripes;
+                        }
+
+                        /*!
+                         * @brief Computes sum_i s_i * P_i over the first std::distance(scalar_first, scalar_last)
+                         * bases of the table.
+                         */
+                        template<typename InputFieldIterator>
+                        group_value_type eval(InputFieldIterator scalar_first, InputFieldIterator scalar_last,
+                                              std::size_t chunks) const {
+                            const std::size_t n = std::distance(scalar_first, scalar_last);
+                            BOOST_ASSERT(n <= bases_amount);
+                            if (n == 0) {
+                                return group_value_type::zero();
+                            }
+
+                            std::vector<integral_type> scalars(n);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < n; ++i) {
+                                scalars[i] = integral_type((*(scalar_first + i)).data);
+                            }
+
+                            chunks = std::max(std::size_t(1), std::min(chunks, n));
+                            std::vector<group_value_type> partial(chunks);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < chunks; ++i) {
+                                partial[i] = eval_chunk(scalars, i * n / chunks, (i + 1) * n / chunks);
+                            }
+
+                            group_value_type result = group_value_type::zero();
+                            for (const group_value_type &p : partial) {
+                                result = result + p;
+                            }
+                            return result;
+                        }
+
+                    private:
+                        // About log2(terms) - 3, the usual choice for bucket multiexps
+                        static std::size_t window_size(std::size_t terms) {
+                            std::size_t c = 1;
+                            while (c < 16 && (std::size_t(1) << (c + 3)) <= terms) {
+                                ++c;
+                            }
+                            return c;
+                        }
+
+                        static std::size_t digit(const integral_type &scalar, std::size_t first_bit, std::size_t bits) {
+                            std::size_t d = 0;
+                            for (std::size_t b = bits; b-- > 0;) {
+                                const std::size_t position = first_bit + b;
+                                d = (d << 1) |
+                                    std::size_t(position < scalar_bits && multiprecision::bit_test(scalar, position));
+                            }
+                            return d;
+                        }
+
+                        group_value_type eval_chunk(const std::vector<integral_type> &scalars, std::size_t first,
+                                                    std::size_t last) const {
+                            const std::size_t c = window_size((last - first) * stripes);
+                            const std::size_t windows = (stripe_bits + c - 1) / c;
+
+                            std::vector<group_value_type> buckets((std::size_t(1) << c) - 1);
+                            group_value_type result = group_value_type::zero();
+
+                            for (std::size_t w = windows; w-- > 0;) {
+                                if (w + 1 != windows) {
+                                    for (std::size_t j = 0; j < c; ++j) {
+                                        result = result.doubled();
+                                    }
+                                }
+
+                                std::fill(buckets.begin(), buckets.end(), group_value_type::zero());
+                                const std::size_t bits = std::min(c, stripe_bits - w * c);
+                                for (std::size_t s = 0; s < stripes; ++s) {
+                                    const group_value_type *bases = table.data() + s * bases_amount;
+                                    for (std::size_t i = first; i < last; ++i) {
+                                        const std::size_t d = digit(scalars[i], s * stripe_bits + w * c, bits);
+                                        if (d != 0) {
+                                            buckets[d - 1] = buckets[d - 1] + bases[i];
+                                        }
+                                    }
+                                }
+
+                                // sum_d d * bucket_d with running sums
+                                group_value_type running = group_value_type::zero();
+                                group_value_type window_sum = group_value_type::zero();
+                                for (std::size_t d = buckets.size(); d-- > 0;) {
+                                    running = running + buckets[d];
+                                    window_sum = window_sum + running;
+                                }
+                                result = result + window_sum;
+                            }
+
+                            return result;
+                        }
+
+                        std::size_t bases_amount;
+                        std::size_t stripes;
+                        std::size_t stripe_bits;
+                        std::vector<group_value_type> table;
+                    };
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_R1CS_GG_PPZKSNARK_FIXED_BASE_MULTIEXP_HPP
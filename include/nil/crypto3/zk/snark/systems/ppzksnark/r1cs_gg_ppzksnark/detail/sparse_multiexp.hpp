@@ -0,0 +1,152 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_R1CS_GG_PPZKSNARK_SPARSE_MULTIEXP_HPP
+#define CRYPTO3_R1CS_GG_PPZKSNARK_SPARSE_MULTIEXP_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+                    /**
+                     * Share of zero and one scalars, in 1/16, from which sparse_multiexp partitions the scalars.
+                     * Below it the partition does not pay for the copies of the remaining bases and scalars.
+                     */
+                    constexpr std::size_t sparse_multiexp_threshold = 4;
+
+                    /*!
+                     * @brief Multiexp for witnesses with many zero and one scalars, e.g. boolean decompositions.
+                     *
+                     * Scalars are partitioned in parallel chunks: zeros are skipped, the bases of ones are
+                     * summed with additions, and only the remaining scalars go through MultiexpMethod. The
+                     * partition is only made when zeros and ones are frequent enough, otherwise the scalars go
+                     * through multiexp_with_mixed_addition, which skips zeros and ones sequentially.
+                     */
+                    template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
+                    typename std::iterator_traits<InputBaseIterator>::value_type
+                        sparse_multiexp(InputBaseIterator bases_first, InputBaseIterator bases_last,
+                                        InputFieldIterator scalars_first, InputFieldIterator scalars_last,
+                                        std::size_t chunks) {
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+
+                        const std::size_t n = std::distance(scalars_first, scalars_last);
+                        BOOST_ASSERT(n <= std::size_t(std::distance(bases_first, bases_last)));
+                        if (n == 0) {
+                            return base_value_type::zero();
+                        }
+
+                        const field_value_type zero = field_value_type::zero();
+                        const field_value_type one = field_value_type::one();
+                        chunks = std::max(std::size_t(1), std::min(chunks, n));
+
+                        std::vector<std::size_t> trivial(chunks, 0);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t i = 0; i < chunks; ++i) {
+                            for (std::size_t j = i * n / chunks; j < (i + 1) * n / chunks; ++j) {
+                                const field_value_type &scalar = *(scalars_first + j);
+                                trivial[i] += (scalar == zero || scalar == one) ? 1 : 0;
+                            }
+                        }
+
+                        std::size_t trivial_amount = 0;
+                        for (std::size_t t : trivial) {
+                            trivial_amount += t;
+                        }
+                        if (trivial_amount * 16 < n * sparse_multiexp_threshold) {
+                            return algebra::multiexp_with_mixed_addition<MultiexpMethod>(
+                                bases_first, bases_first + n, scalars_first, scalars_last, chunks);
+                        }
+
+                        std::vector<base_value_type> ones_sums(chunks, base_value_type::zero());
+                        std::vector<std::vector<base_value_type>> chunk_bases(chunks);
+                        std::vector<std::vector<field_value_type>> chunk_scalars(chunks);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t i = 0; i < chunks; ++i) {
+                            const std::size_t first = i * n / chunks;
+                            const std::size_t last = (i + 1) * n / chunks;
+                            chunk_bases[i].reserve(last - first - trivial[i]);
+                            chunk_scalars[i].reserve(last - first - trivial[i]);
+
+                            for (std::size_t j = first; j < last; ++j) {
+                                const field_value_type &scalar = *(scalars_first + j);
+                                if (scalar == zero) {
+                                    // do nothing
+                                } else if (scalar == one) {
+#ifdef USE_MIXED_ADDITION
+                                    ones_sums[i] = ones_sums[i].mixed_add(*(bases_first + j));
+#else
+                                    ones_sums[i] = ones_sums[i] + *(bases_first + j);
+#endif
+                                } else {
+                                    chunk_bases[i].emplace_back(*(bases_first + j));
+                                    chunk_scalars[i].emplace_back(scalar);
+                                }
+                            }
+                        }
+
+                        std::vector<base_value_type> bases;
+                        std::vector<field_value_type> scalars;
+                        bases.reserve(n - trivial_amount);
+                        scalars.reserve(n - trivial_amount);
+                        base_value_type result = base_value_type::zero();
+                        for (std::size_t i = 0; i < chunks; ++i) {
+                            bases.insert(bases.end(), chunk_bases[i].begin(), chunk_bases[i].end());
+                            scalars.insert(scalars.end(), chunk_scalars[i].begin(), chunk_scalars[i].end());
+                            result = result + ones_sums[i];
+                        }
+
+                        if (bases.empty()) {
+                            return result;
+                        }
+                        return result + algebra::multiexp<MultiexpMethod>(bases.begin(), bases.end(), scalars.begin(),
+                                                                          scalars.end(), chunks);
+                    }
+                }    // namespace detail
+            }        // namespace snark
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_R1CS_GG_PPZKSNARK_SPARSE_MULTIEXP_HPP
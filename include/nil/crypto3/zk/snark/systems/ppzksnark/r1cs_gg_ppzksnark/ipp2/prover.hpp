@@ -27,6 +27,10 @@
 #ifndef CRYPTO3_R1CS_GG_PPZKSNARK_IPP2_PROVE_HPP
 #define CRYPTO3_R1CS_GG_PPZKSNARK_IPP2_PROVE_HPP
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <algorithm>
 #include <vector>
 #include <tuple>
@@ -46,12 +50,15 @@
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 
+#include <nil/crypto3/zk/commitments/detail/polynomial/multi_pair.hpp>
+
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/detail/basic_policy.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/ipp2/proof.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/ipp2/srs.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/ipp2/transcript.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/proof.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/prover.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -71,6 +78,16 @@ namespace nil {
                     return powers;
                 }
 
+                /// Number of chunks the multiexponentiations of the aggregation are split into
+                inline std::size_t aggregation_chunks() {
+#ifdef MULTICORE
+                    const std::size_t chunks = commitments::detail::multicore_threads();
+#else
+                    const std::size_t chunks = 1;
+#endif
+                    return chunks;
+                }
+
                 /// compress is similar to commit::{V,W}KEY::compress: it modifies the `vec`
                 /// vector by setting the value at index $i:0 -> split$  $vec[i] = vec[i] +
                 /// vec[i+split]^scaler$. The `vec` vector is half of its size after this call.
@@ -82,11 +99,14 @@ namespace nil {
                     std::is_same<typename CurveType::scalar_field_type::value_type, ValueType>::value>::type
                     compress(InputRange &vec, std::size_t split,
                              const typename CurveType::scalar_field_type::value_type &scalar) {
-                    std::for_each(boost::make_zip_iterator(boost::make_tuple(vec.begin(), vec.begin() + split)),
-                                  boost::make_zip_iterator(boost::make_tuple(vec.begin() + split, vec.end())),
-                                  [&](const boost::tuple<ValueType &, ValueType &> &t) {
-                                      t.template get<0>() = t.template get<0>() + t.template get<1>() * scalar;
-                                  });
+                    BOOST_ASSERT(2 * split <= vec.size());
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                    for (std::size_t i = 0; i < split; i++) {
+                        vec[i] = vec[i] + vec[i + split] * scalar;
+                    }
                     vec.resize(split);
                 }
 
@@ -211,10 +231,10 @@ namespace nil {
                     return typename commitments::kzg_ipp2<typename GroupType::curve_type>::template opening_type<
                         GroupType> {algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(
                                         srs_powers_alpha_first, srs_powers_alpha_last, quotient_polynomial.begin(),
-                                        quotient_polynomial.end(), 1),
+                                        quotient_polynomial.end(), aggregation_chunks()),
                                     algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(
                                         srs_powers_beta_first, srs_powers_beta_last, quotient_polynomial.begin(),
-                                        quotient_polynomial.end(), 1)};
+                                        quotient_polynomial.end(), aggregation_chunks())};
                 }
 
                 template<typename CurveType, typename InputG2Iterator, typename InputScalarIterator>
@@ -345,59 +365,80 @@ namespace nil {
                     tr.write_domain_separator(domain_separator.begin(), domain_separator.end());
                     typename CurveType::scalar_field_type::value_type _i = tr.read_challenge();
 
+                    const std::size_t chunks = aggregation_chunks();
                     while (m_a.size() > 1) {
                         // recursive step
                         // Recurse with problem of half size
                         std::size_t split = m_a.size() / 2;
 
-                        auto [vk_left, vk_right] = vkey.split(split);
-                        auto [wk_left, wk_right] = wkey.split(split);
+                        const auto vk_split = vkey.split(split);
+                        const auto wk_split = wkey.split(split);
+                        const auto &vk_left = vk_split.first;
+                        const auto &vk_right = vk_split.second;
+                        const auto &wk_left = wk_split.first;
+                        const auto &wk_right = wk_split.second;
+
+                        typename commitments::kzg_ipp2<CurveType>::output_type tab_l, tab_r, tuc_l, tuc_r;
+                        typename CurveType::gt_type::value_type zab_l, zab_r;
+                        typename CurveType::template g1_type<>::value_type zc_l, zc_r;
 
-                        // TODO: parallel
+                        // The commitments of a round are independent of each other, they are computed
+                        // concurrently
                         // See section 3.3 for paper version with equivalent names
-                        // TIPP part
-                        typename commitments::kzg_ipp2<CurveType>::output_type tab_l =
-                            commitments::kzg_ipp2<CurveType>::pair(vk_left, wk_right, m_a.begin() + split, m_a.end(),
-                                                                   m_b.begin(), m_b.begin() + split);
-                        typename commitments::kzg_ipp2<CurveType>::output_type tab_r =
-                            commitments::kzg_ipp2<CurveType>::pair(vk_right, wk_left, m_a.begin(), m_a.begin() + split,
-                                                                   m_b.begin() + split, m_b.end());
-
-                        // \prod e(A_right,B_left)
-                        typename CurveType::gt_type::value_type zab_l = CurveType::gt_type::value_type::one();
-                        std::for_each(
-                            boost::make_zip_iterator(boost::make_tuple(m_a.begin() + split, m_b.begin())),
-                            boost::make_zip_iterator(boost::make_tuple(m_a.end(), m_b.begin() + split)),
-                            [&](const boost::tuple<const typename CurveType::template g1_type<>::value_type &,
-                                                   const typename CurveType::template g2_type<>::value_type &> &t) {
-                                zab_l = zab_l * algebra::pair<CurveType>(t.template get<0>(), t.template get<1>());
-                            });
-                        zab_l = algebra::final_exponentiation<CurveType>(zab_l);
-                        typename CurveType::gt_type::value_type zab_r = CurveType::gt_type::value_type::one();
-                        std::for_each(
-                            boost::make_zip_iterator(boost::make_tuple(m_a.begin(), m_b.begin() + split)),
-                            boost::make_zip_iterator(boost::make_tuple(m_a.begin() + split, m_b.end())),
-                            [&](const boost::tuple<const typename CurveType::template g1_type<>::value_type &,
-                                                   const typename CurveType::template g2_type<>::value_type &> &t) {
-                                zab_r = zab_r * algebra::pair<CurveType>(t.template get<0>(), t.template get<1>());
-                            });
-                        zab_r = algebra::final_exponentiation<CurveType>(zab_r);
-
-                        // MIPP part
-                        // z_l = c[n':] ^ r[:n']
-                        typename CurveType::template g1_type<>::value_type zc_l =
-                            algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(
-                                m_c.begin() + split, m_c.end(), m_r.begin(), m_r.begin() + split, 1);
-                        // Z_r = c[:n'] ^ r[n':]
-                        typename CurveType::template g1_type<>::value_type zc_r =
-                            algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(
-                                m_c.begin(), m_c.begin() + split, m_r.begin() + split, m_r.end(), 1);
-                        // u_l = c[n':] * v[:n']
-                        typename commitments::kzg_ipp2<CurveType>::output_type tuc_l =
-                            commitments::kzg_ipp2<CurveType>::single(vk_left, m_c.begin() + split, m_c.end());
-                        // u_r = c[:n'] * v[n':]
-                        typename commitments::kzg_ipp2<CurveType>::output_type tuc_r =
-                            commitments::kzg_ipp2<CurveType>::single(vk_right, m_c.begin(), m_c.begin() + split);
+#ifdef MULTICORE
+#pragma omp parallel sections num_threads(commitments::detail::multicore_threads())
+#endif
+                        {
+                            // TIPP part
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                            tab_l = commitments::kzg_ipp2<CurveType>::pair(vk_left, wk_right, m_a.begin() + split,
+                                                                           m_a.end(), m_b.begin(), m_b.begin() + split);
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                            tab_r = commitments::kzg_ipp2<CurveType>::pair(vk_right, wk_left, m_a.begin(),
+                                                                           m_a.begin() + split, m_b.begin() + split,
+                                                                           m_b.end());
+                            // \prod e(A_right,B_left)
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                            zab_l = algebra::final_exponentiation<CurveType>(commitments::detail::multi_pair<CurveType>(
+                                m_a.begin() + split, m_a.end(), m_b.begin(), m_b.begin() + split));
+                            // \prod e(A_left,B_right)
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                            zab_r = algebra::final_exponentiation<CurveType>(commitments::detail::multi_pair<CurveType>(
+                                m_a.begin(), m_a.begin() + split, m_b.begin() + split, m_b.end()));
+
+                            // MIPP part
+                            // z_l = c[n':] ^ r[:n']
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                            zc_l = algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(
+                                m_c.begin() + split, m_c.end(), m_r.begin(), m_r.begin() + split, chunks);
+                            // Z_r = c[:n'] ^ r[n':]
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                            zc_r = algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(
+                                m_c.begin(), m_c.begin() + split, m_r.begin() + split, m_r.end(), chunks);
+                            // u_l = c[n':] * v[:n']
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                            tuc_l = commitments::kzg_ipp2<CurveType>::single(vk_left, m_c.begin() + split, m_c.end());
+                            // u_r = c[:n'] * v[n':]
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                            tuc_r =
+                                commitments::kzg_ipp2<CurveType>::single(vk_right, m_c.begin(), m_c.begin() + split);
+                        }
 
                         // Fiat-Shamir challenge
                         // combine both TIPP and MIPP transcript
@@ -529,7 +570,6 @@ namespace nil {
                     BOOST_ASSERT((nproofs & (nproofs - 1)) == 0);
                     BOOST_ASSERT(srs.has_correct_len(nproofs));
 
-                    // TODO: parallel
                     // We first commit to A B and C - these commitments are what the verifier
                     // will use later to verify the TIPP and MIPP proofs
                     std::vector<typename CurveType::template g1_type<>::value_type> a, c;
@@ -545,11 +585,21 @@ namespace nil {
                     // A and B are committed together in this scheme
                     // we need to take the reference so the macro doesn't consume the value
                     // first
-                    typename commitments::kzg_ipp2<CurveType>::output_type com_ab =
-                        commitments::kzg_ipp2<CurveType>::pair(srs.vkey, srs.wkey, a.begin(), a.end(), b.begin(),
-                                                               b.end());
-                    typename commitments::kzg_ipp2<CurveType>::output_type com_c =
-                        commitments::kzg_ipp2<CurveType>::single(srs.vkey, c.begin(), c.end());
+                    typename commitments::kzg_ipp2<CurveType>::output_type com_ab, com_c;
+#ifdef MULTICORE
+#pragma omp parallel sections num_threads(commitments::detail::multicore_threads())
+#endif
+                    {
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                        com_ab = commitments::kzg_ipp2<CurveType>::pair(srs.vkey, srs.wkey, a.begin(), a.end(),
+                                                                        b.begin(), b.end());
+#ifdef MULTICORE
+#pragma omp section
+#endif
+                        com_c = commitments::kzg_ipp2<CurveType>::single(srs.vkey, c.begin(), c.end());
+                    }
 
                     // Derive a random scalar to perform a linear combination of proofs
                     constexpr std::array<std::uint8_t, 9> application_tag = {'s', 'n', 'a', 'r', 'k',
@@ -582,22 +632,13 @@ namespace nil {
                                                const typename CurveType::scalar_field_type::value_type &> &t) {
                             b_r.emplace_back((t.template get<0>() * t.template get<1>()));
                         });
-                    // TODO: parallel
                     // compute A * B^r for the verifier
-                    // auto ip_ab = algebra::pair<CurveType>(a, b_r);
-                    typename CurveType::gt_type::value_type ip_ab = CurveType::gt_type::value_type::one();
-                    std::for_each(
-                        boost::make_zip_iterator(boost::make_tuple(a.begin(), b_r.begin())),
-                        boost::make_zip_iterator(boost::make_tuple(a.end(), b_r.end())),
-                        [&](const boost::tuple<const typename CurveType::template g1_type<>::value_type &,
-                                               const typename CurveType::template g2_type<>::value_type &> &t) {
-                            ip_ab = ip_ab * algebra::pair<CurveType>(t.template get<0>(), t.template get<1>());
-                        });
-                    ip_ab = algebra::final_exponentiation<CurveType>(ip_ab);
+                    typename CurveType::gt_type::value_type ip_ab = algebra::final_exponentiation<CurveType>(
+                        commitments::detail::multi_pair<CurveType>(a.begin(), a.end(), b_r.begin(), b_r.end()));
                     // compute C^r for the verifier
                     typename CurveType::template g1_type<>::value_type agg_c =
-                        algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(c.begin(), c.end(),
-                                                                                         r_vec.begin(), r_vec.end(), 1);
+                        algebra::multiexp<algebra::policies::multiexp_method_bos_coster>(
+                            c.begin(), c.end(), r_vec.begin(), r_vec.end(), aggregation_chunks());
                     tr.template write<typename CurveType::gt_type>(ip_ab);
                     tr.template write<typename CurveType::template g1_type<>>(agg_c);
 
@@ -0,0 +1,633 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+// @file Declaration of a fast binary serialization of the R1CS GG-ppzkSNARK proving key.
+//
+// The layout stores the group elements of the proving key as fixed-width records of 64-bit limbs,
+// so that a file is decoded in parallel record by record, without parsing a serialized stream of
+// variable-length elements. Loading still deserializes every element into memory owned by the
+// key. A file is only valid for the same curve and byte order it was written with, which is
+// recorded in its header.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_R1CS_GG_PPZKSNARK_MAPPED_PROVING_KEY_HPP
+#define CRYPTO3_R1CS_GG_PPZKSNARK_MAPPED_PROVING_KEY_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/optional.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/zk/commitments/polynomial/knowledge_commitment.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/proving_key.hpp>
+#include <nil/crypto3/zk/commitments/detail/multicore.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+                    /**
+                     * Checksum of the mapped proving key: 64-bit FNV-1a of every block of block_size bytes,
+                     * then FNV-1a of the block digests. Blocks are independent, so a mapped file is checked
+                     * in parallel, and the result does not depend on the number of threads.
+                     */
+                    class mapped_key_checksum {
+                    public:
+                        constexpr static const std::size_t block_size = std::size_t(1) << 20;
+
+                        mapped_key_checksum() : block_state(offset_basis), block_fill(0), state(offset_basis) {
+                        }
+
+                        void update(const std::uint8_t *data, std::size_t size) {
+                            while (size > 0) {
+                                const std::size_t n = std::min(size, block_size - block_fill);
+                                block_state = fnv1a(block_state, data, n);
+                                block_fill += n;
+                                data += n;
+                                size -= n;
+                                if (block_fill == block_size) {
+                                    finish_block();
+                                }
+                            }
+                        }
+
+                        std::uint64_t digest() {
+                            if (block_fill > 0) {
+                                finish_block();
+                            }
+                            return state;
+                        }
+
+                        static std::uint64_t compute(const std::uint8_t *data, std::size_t size) {
+                            const std::size_t blocks = (size + block_size - 1) / block_size;
+                            std::vector<std::uint64_t> digests(blocks);
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < blocks; ++i) {
+                                const std::size_t first = i * block_size;
+                                digests[i] = fnv1a(offset_basis, data + first, std::min(block_size, size - first));
+                            }
+
+                            std::uint64_t result = offset_basis;
+                            for (const std::uint64_t &d : digests) {
+                                result = fnv1a(result, reinterpret_cast<const std::uint8_t *>(&d), sizeof(d));
+                            }
+                            return result;
+                        }
+
+                        static std::uint64_t fnv1a(std::uint64_t h, const std::uint8_t *data, std::size_t size) {
+                            for (std::size_t i = 0; i < size; ++i) {
+                                h = (h ^ data[i]) * prime;
+                            }
+                            return h;
+                        }
+
+                    private:
+                        constexpr static const std::uint64_t offset_basis = 0xcbf29ce484222325ull;
+                        constexpr static const std::uint64_t prime = 0x100000001b3ull;
+
+                        void finish_block() {
+                            state = fnv1a(state, reinterpret_cast<const std::uint8_t *>(&block_state),
+                                          sizeof(block_state));
+                            block_state = offset_basis;
+                            block_fill = 0;
+                        }
+
+                        std::uint64_t block_state;
+                        std::size_t block_fill;
+                        std::uint64_t state;
+                    };
+                }    // namespace detail
+
+
+                /**
+                 * Header of the mapped proving key file. Every section starts at an offset aligned to
+                 * alignment bytes and holds count records of its type.
+                 */
+                struct r1cs_gg_ppzksnark_mapped_proving_key_header {
+                    enum section_id {
+                        fixed_g1_section,    // alpha_g1, beta_g1, delta_g1
+                        fixed_g2_section,    // beta_g2, delta_g2
+                        A_query_section,
+                        B_query_indices_section,
+                        B_query_values_section,
+                        H_query_section,
+                        L_query_section,
+                        sections_amount
+                    };
+
+                    struct section_type {
+                        std::uint64_t offset;
+                        std::uint64_t count;
+                    };
+
+                    constexpr static const std::uint64_t magic_value = 0x4b50474731534352ull;    // "RCS1GGPK"
+                    constexpr static const std::uint32_t version_value = 1;
+                    constexpr static const std::uint32_t byte_order_value = 0x01020304;
+                    constexpr static const std::uint32_t alignment_value = 64;
+
+                    std::uint64_t magic;
+                    std::uint32_t version;
+                    std::uint32_t byte_order;
+                    std::uint32_t g1_record_size;
+                    std::uint32_t g2_record_size;
+                    std::uint32_t kc_record_size;
+                    std::uint32_t alignment;
+                    std::uint64_t B_query_domain_size;
+                    std::uint64_t file_size;
+                    section_type sections[sections_amount];
+                    // Checksum of everything after the header, only verified when the key is validated
+                    std::uint64_t payload_checksum;
+                    // Checksum of the fields above, always verified
+                    std::uint64_t header_checksum;
+
+                    std::uint64_t compute_header_checksum() const {
+                        return detail::mapped_key_checksum::fnv1a(
+                            0xcbf29ce484222325ull, reinterpret_cast<const std::uint8_t *>(this),
+                            offsetof(r1cs_gg_ppzksnark_mapped_proving_key_header, header_checksum));
+                    }
+                };
+
+                /**
+                 * Proving key of the R1CS GG-ppzkSNARK deserialized from a file or any other memory buffer
+                 * in the binary layout written by write().
+                 *
+                 * Group elements are stored as fixed-width records: the X, Y and Z coordinates one after
+                 * another, every base field coordinate as limbs_amount 64-bit limbs, the least significant
+                 * limb first. Coordinates of G2 hold their components over the base field in order. Loading
+                 * is a full deserialization into the vectors of the key, done in parallel record by record;
+                 * the buffer is not referenced once load() returns.
+                 *
+                 * Loading rejects headers of another curve, coordinates out of the field and B_query indices
+                 * out of the domain or out of order. With validation enabled, the checksum of the payload
+                 * and the well-formedness of every group element are checked as well, which is only needed
+                 * for keys of an untrusted origin.
+                 * The constraint system is not a part of the layout and is passed to the prover separately.
+                 */
+                template<typename CurveType>
+                class r1cs_gg_ppzksnark_mapped_proving_key {
+                    typedef r1cs_gg_ppzksnark_mapped_proving_key_header header_type;
+
+                public:
+                    typedef CurveType curve_type;
+                    typedef r1cs_gg_ppzksnark_proving_key<CurveType> proving_key_type;
+
+                    typedef typename CurveType::template g1_type<> g1_type;
+                    typedef typename CurveType::template g2_type<> g2_type;
+                    typedef typename g1_type::value_type g1_value_type;
+                    typedef typename g2_type::value_type g2_value_type;
+                    typedef typename commitments::knowledge_commitment<g2_type, g1_type>::value_type kc_value_type;
+
+                    typedef typename g1_type::field_type base_field_type;
+                    typedef typename g2_type::field_type g2_field_type;
+                    typedef typename base_field_type::value_type base_field_value_type;
+                    typedef typename g2_field_type::value_type g2_field_value_type;
+
+                    constexpr static const std::size_t limbs_amount = (base_field_type::modulus_bits + 63) / 64;
+
+                    typedef std::array<std::uint64_t, 3 * limbs_amount> g1_record_type;
+                    typedef std::array<std::uint64_t, 3 * g2_field_type::arity * limbs_amount> g2_record_type;
+                    // g followed by h
+                    typedef std::array<std::uint64_t, 3 * (g2_field_type::arity + 1) * limbs_amount> kc_record_type;
+
+                    g1_value_type alpha_g1;
+                    g1_value_type beta_g1;
+                    g2_value_type beta_g2;
+                    g1_value_type delta_g1;
+                    g2_value_type delta_g2;
+
+                    std::vector<g1_value_type> A_query;
+                    std::size_t B_query_domain_size;
+                    std::vector<std::size_t> B_query_indices;
+                    std::vector<kc_value_type> B_query_values;
+                    std::vector<g1_value_type> H_query;
+                    std::vector<g1_value_type> L_query;
+
+                    /*!
+                     * @brief Writes the proving key in the binary layout.
+                     */
+                    static void write(const proving_key_type &proving_key, std::ostream &os) {
+                        header_type header = make_header(proving_key);
+
+                        detail::mapped_key_checksum checksum;
+                        for_each_chunk(proving_key, header, [&](const std::uint8_t *data, std::size_t size) {
+                            checksum.update(data, size);
+                        });
+                        header.payload_checksum = checksum.digest();
+                        header.header_checksum = header.compute_header_checksum();
+
+                        os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+                        for_each_chunk(proving_key, header, [&](const std::uint8_t *data, std::size_t size) {
+                            os.write(reinterpret_cast<const char *>(data), size);
+                        });
+                    }
+
+                    /*!
+                     * @brief Loads the proving key from a buffer in the binary layout. Returns none if the
+                     * buffer does not hold a key for this curve or, with validate set, if it is corrupted.
+                     */
+                    static boost::optional<r1cs_gg_ppzksnark_mapped_proving_key> load(const std::uint8_t *data,
+                                                                                       std::size_t size,
+                                                                                       bool validate = true) {
+                        header_type header;
+                        if (size < sizeof(header)) {
+                            return boost::none;
+                        }
+                        std::memcpy(&header, data, sizeof(header));
+                        if (!check_header(header, size)) {
+                            return boost::none;
+                        }
+                        if (validate && header.payload_checksum != detail::mapped_key_checksum::compute(
+                                                                       data + sizeof(header), size - sizeof(header))) {
+                            return boost::none;
+                        }
+
+                        r1cs_gg_ppzksnark_mapped_proving_key key;
+                        std::vector<g1_value_type> fixed_g1;
+                        std::vector<g2_value_type> fixed_g2;
+                        if (!decode_section<g1_record_type>(header, data, header_type::fixed_g1_section, fixed_g1) ||
+                            !decode_section<g2_record_type>(header, data, header_type::fixed_g2_section, fixed_g2) ||
+                            !decode_section<g1_record_type>(header, data, header_type::A_query_section,
+                                                            key.A_query) ||
+                            !decode_section<std::uint64_t>(header, data, header_type::B_query_indices_section,
+                                                           key.B_query_indices) ||
+                            !decode_section<kc_record_type>(header, data, header_type::B_query_values_section,
+                                                            key.B_query_values) ||
+                            !decode_section<g1_record_type>(header, data, header_type::H_query_section,
+                                                            key.H_query) ||
+                            !decode_section<g1_record_type>(header, data, header_type::L_query_section,
+                                                            key.L_query)) {
+                            return boost::none;
+                        }
+                        key.alpha_g1 = fixed_g1[0];
+                        key.beta_g1 = fixed_g1[1];
+                        key.delta_g1 = fixed_g1[2];
+                        key.beta_g2 = fixed_g2[0];
+                        key.delta_g2 = fixed_g2[1];
+                        key.B_query_domain_size = header.B_query_domain_size;
+
+                        // The multiexps index the witness by B_query_indices, so they are checked on every load
+                        if (!key.check_indices() || (validate && !key.check_elements())) {
+                            return boost::none;
+                        }
+                        return key;
+                    }
+
+                    /*!
+                     * @brief Loads the proving key from a file, which is mapped read-only while it is read.
+                     */
+                    static boost::optional<r1cs_gg_ppzksnark_mapped_proving_key> open(const std::string &path,
+                                                                                       bool validate = true) {
+                        try {
+                            boost::interprocess::file_mapping file(path.c_str(), boost::interprocess::read_only);
+                            boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+                            return load(static_cast<const std::uint8_t *>(region.get_address()), region.get_size(),
+                                        validate);
+                        } catch (const boost::interprocess::interprocess_exception &) {
+                            return boost::none;
+                        }
+                    }
+
+                private:
+                    // Number of records encoded at once by write()
+                    constexpr static const std::size_t chunk_size = std::size_t(1) << 16;
+
+                    static std::size_t align(std::size_t offset) {
+                        return (offset + header_type::alignment_value - 1) / header_type::alignment_value *
+                               header_type::alignment_value;
+                    }
+
+                    static header_type make_header(const proving_key_type &proving_key) {
+                        header_type header;
+                        std::memset(&header, 0, sizeof(header));
+
+                        header.magic = header_type::magic_value;
+                        header.version = header_type::version_value;
+                        header.byte_order = header_type::byte_order_value;
+                        header.g1_record_size = sizeof(g1_record_type);
+                        header.g2_record_size = sizeof(g2_record_type);
+                        header.kc_record_size = sizeof(kc_record_type);
+                        header.alignment = header_type::alignment_value;
+                        header.B_query_domain_size = proving_key.B_query.domain_size_;
+
+                        const std::size_t counts[header_type::sections_amount] = {
+                            3, 2, proving_key.A_query.size(), proving_key.B_query.indices.size(),
+                            proving_key.B_query.values.size(), proving_key.H_query.size(), proving_key.L_query.size()};
+
+                        std::size_t offset = sizeof(header_type);
+                        for (std::size_t i = 0; i < header_type::sections_amount; ++i) {
+                            header.sections[i].offset = align(offset);
+                            header.sections[i].count = counts[i];
+                            offset = header.sections[i].offset + counts[i] * record_size(header, i);
+                        }
+                        header.file_size = offset;
+
+                        return header;
+                    }
+
+                    static std::size_t record_size(const header_type &header, std::size_t section) {
+                        switch (section) {
+                            case header_type::fixed_g2_section:
+                                return header.g2_record_size;
+                            case header_type::B_query_indices_section:
+                                return sizeof(std::uint64_t);
+                            case header_type::B_query_values_section:
+                                return header.kc_record_size;
+                            default:
+                                return header.g1_record_size;
+                        }
+                    }
+
+                    static void encode(const base_field_value_type &value, std::uint64_t *limbs) {
+                        std::fill(limbs, limbs + limbs_amount, 0);
+                        nil::crypto3::multiprecision::export_bits(
+                            typename base_field_type::integral_type(value.data), limbs, 64, false);
+                    }
+
+                    static void encode(const g2_field_value_type &value, std::uint64_t *limbs) {
+                        for (std::size_t i = 0; i < g2_field_type::arity; ++i) {
+                            encode(value.data[i], limbs + i * limbs_amount);
+                        }
+                    }
+
+                    static bool decode(const std::uint64_t *limbs, base_field_value_type &value) {
+                        // The bits above the modulus width are never set by encode()
+                        if (base_field_type::modulus_bits % 64 != 0 &&
+                            (limbs[limbs_amount - 1] >> (base_field_type::modulus_bits % 64)) != 0) {
+                            return false;
+                        }
+
+                        typename base_field_type::integral_type integral;
+                        nil::crypto3::multiprecision::import_bits(integral, limbs, limbs + limbs_amount, 64, false);
+                        if (integral >= base_field_type::modulus) {
+                            return false;
+                        }
+                        value = base_field_value_type(integral);
+                        return true;
+                    }
+
+                    static bool decode(const std::uint64_t *limbs, g2_field_value_type &value) {
+                        bool result = true;
+                        for (std::size_t i = 0; i < g2_field_type::arity; ++i) {
+                            result = decode(limbs + i * limbs_amount, value.data[i]) && result;
+                        }
+                        return result;
+                    }
+
+                    template<typename ValueType>
+                    static void encode_point(const ValueType &point, std::uint64_t *limbs, std::size_t stride) {
+                        encode(point.X, limbs);
+                        encode(point.Y, limbs + stride);
+                        encode(point.Z, limbs + 2 * stride);
+                    }
+
+                    template<typename ValueType, typename FieldValueType>
+                    static bool decode_point(const std::uint64_t *limbs, std::size_t stride, ValueType &point) {
+                        FieldValueType X, Y, Z;
+                        if (!decode(limbs, X) || !decode(limbs + stride, Y) || !decode(limbs + 2 * stride, Z)) {
+                            return false;
+                        }
+                        point = ValueType(X, Y, Z);
+                        return true;
+                    }
+
+                    static void encode_record(const g1_value_type &value, g1_record_type &record) {
+                        encode_point(value, record.data(), limbs_amount);
+                    }
+
+                    static void encode_record(const g2_value_type &value, g2_record_type &record) {
+                        encode_point(value, record.data(), g2_field_type::arity * limbs_amount);
+                    }
+
+                    static void encode_record(const kc_value_type &value, kc_record_type &record) {
+                        encode_point(value.g, record.data(), g2_field_type::arity * limbs_amount);
+                        encode_point(value.h, record.data() + std::tuple_size<g2_record_type>::value,
+                                     limbs_amount);
+                    }
+
+                    static void encode_record(std::size_t value, std::uint64_t &record) {
+                        record = value;
+                    }
+
+                    static bool decode_record(const g1_record_type &record, g1_value_type &value) {
+                        return decode_point<g1_value_type, base_field_value_type>(record.data(), limbs_amount,
+                                                                                  value);
+                    }
+
+                    static bool decode_record(const g2_record_type &record, g2_value_type &value) {
+                        return decode_point<g2_value_type, g2_field_value_type>(
+                            record.data(), g2_field_type::arity * limbs_amount, value);
+                    }
+
+                    static bool decode_record(const kc_record_type &record, kc_value_type &value) {
+                        g2_value_type g;
+                        g1_value_type h;
+                        if (!decode_point<g2_value_type, g2_field_value_type>(
+                                record.data(), g2_field_type::arity * limbs_amount, g) ||
+                            !decode_point<g1_value_type, base_field_value_type>(
+                                record.data() + std::tuple_size<g2_record_type>::value, limbs_amount, h)) {
+                            return false;
+                        }
+                        value = kc_value_type(g, h);
+                        return true;
+                    }
+
+                    static bool decode_record(const std::uint64_t &record, std::size_t &value) {
+                        value = record;
+                        return value == record;
+                    }
+
+                    // Encodes count values starting at first chunk by chunk and passes the records to f
+                    template<typename RecordType, typename InputIterator, typename F>
+                    static void encode_section(InputIterator first, std::size_t count, F &f) {
+                        std::vector<RecordType> records;
+                        for (std::size_t begin = 0; begin < count; begin += chunk_size) {
+                            const std::size_t n = std::min(chunk_size, count - begin);
+                            records.resize(n);
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(commitments::detail::multicore_threads())
+#endif
+                            for (std::size_t i = 0; i < n; ++i) {
+                                encode_record(*(first + begin + i), records[i]);
+                            }
+                            f(reinterpret_cast<const std::uint8_t *>(records.data()), n * sizeof(RecordType));
+                        }
+                    }
+
+                    template<typename RecordType, typename ValueType>
+                    static bool decode_section(const header_type &header, const std::uint8_t *data, std::size_t id,
+                                               std::vector<ValueType> &values) {
+                        const std::uint8_t *first = data + header.sections[id].offset;
+                        values.resize(header.sections[id].count);
+
+                        bool result = true;
+#ifdef MULTICORE
+#pragma omp parallel for reduction(&& : result) num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t i = 0; i < values.size(); ++i) {
+                            // Records are copied out, the buffer does not have to be aligned
+                            RecordType record;
+                            std::memcpy(&record, first + i * sizeof(RecordType), sizeof(RecordType));
+                            result = decode_record(record, values[i]) && result;
+                        }
+                        return result;
+                    }
+
+                    // Calls f for every piece of the payload in file order, padding included
+                    template<typename F>
+                    static void for_each_chunk(const proving_key_type &proving_key, const header_type &header, F f) {
+                        const std::vector<std::uint8_t> padding(header_type::alignment_value, 0);
+                        const std::vector<g1_value_type> fixed_g1 = {proving_key.alpha_g1, proving_key.beta_g1,
+                                                                     proving_key.delta_g1};
+                        const std::vector<g2_value_type> fixed_g2 = {proving_key.beta_g2, proving_key.delta_g2};
+
+                        std::size_t offset = sizeof(header_type);
+                        for (std::size_t i = 0; i < header_type::sections_amount; ++i) {
+                            f(padding.data(), header.sections[i].offset - offset);
+                            switch (i) {
+                                case header_type::fixed_g1_section:
+                                    encode_section<g1_record_type>(fixed_g1.begin(), fixed_g1.size(), f);
+                                    break;
+                                case header_type::fixed_g2_section:
+                                    encode_section<g2_record_type>(fixed_g2.begin(), fixed_g2.size(), f);
+                                    break;
+                                case header_type::A_query_section:
+                                    encode_section<g1_record_type>(proving_key.A_query.begin(),
+                                                                   proving_key.A_query.size(), f);
+                                    break;
+                                case header_type::B_query_indices_section:
+                                    encode_section<std::uint64_t>(proving_key.B_query.indices.begin(),
+                                                                  proving_key.B_query.indices.size(), f);
+                                    break;
+                                case header_type::B_query_values_section:
+                                    encode_section<kc_record_type>(proving_key.B_query.values.begin(),
+                                                                   proving_key.B_query.values.size(), f);
+                                    break;
+                                case header_type::H_query_section:
+                                    encode_section<g1_record_type>(proving_key.H_query.begin(),
+                                                                   proving_key.H_query.size(), f);
+                                    break;
+                                case header_type::L_query_section:
+                                    encode_section<g1_record_type>(proving_key.L_query.begin(),
+                                                                   proving_key.L_query.size(), f);
+                                    break;
+                            }
+                            offset = header.sections[i].offset + header.sections[i].count * record_size(header, i);
+                        }
+                    }
+
+                    static bool check_header(const header_type &header, std::size_t size) {
+                        if (header.magic != header_type::magic_value || header.version != header_type::version_value ||
+                            header.byte_order != header_type::byte_order_value ||
+                            header.g1_record_size != sizeof(g1_record_type) ||
+                            header.g2_record_size != sizeof(g2_record_type) ||
+                            header.kc_record_size != sizeof(kc_record_type) ||
+                            header.alignment != header_type::alignment_value ||
+                            header.header_checksum != header.compute_header_checksum() || header.file_size != size) {
+                            return false;
+                        }
+                        if (header.sections[header_type::fixed_g1_section].count != 3 ||
+                            header.sections[header_type::fixed_g2_section].count != 2 ||
+                            header.sections[header_type::B_query_indices_section].count !=
+                                header.sections[header_type::B_query_values_section].count) {
+                            return false;
+                        }
+
+                        std::size_t end = sizeof(header_type);
+                        for (std::size_t i = 0; i < header_type::sections_amount; ++i) {
+                            const header_type::section_type &section = header.sections[i];
+                            if (section.offset % header_type::alignment_value != 0 || section.offset < end ||
+                                section.offset > size ||
+                                section.count > (size - section.offset) / record_size(header, i)) {
+                                return false;
+                            }
+                            end = section.offset + section.count * record_size(header, i);
+                        }
+                        return true;
+                    }
+
+                    static bool is_well_formed(const g1_value_type &value) {
+                        return value.is_well_formed();
+                    }
+
+                    static bool is_well_formed(const g2_value_type &value) {
+                        return value.is_well_formed();
+                    }
+
+                    static bool is_well_formed(const kc_value_type &value) {
+                        return value.g.is_well_formed() && value.h.is_well_formed();
+                    }
+
+                    template<typename ValueType>
+                    static bool check_points(const std::vector<ValueType> &points) {
+                        bool result = true;
+#ifdef MULTICORE
+#pragma omp parallel for reduction(&& : result) num_threads(commitments::detail::multicore_threads())
+#endif
+                        for (std::size_t i = 0; i < points.size(); ++i) {
+                            result = result && is_well_formed(points[i]);
+                        }
+                        return result;
+                    }
+
+                    bool check_indices() const {
+                        for (std::size_t i = 0; i < B_query_indices.size(); ++i) {
+                            if (B_query_indices[i] >= B_query_domain_size ||
+                                (i > 0 && B_query_indices[i - 1] >= B_query_indices[i])) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    bool check_elements() const {
+                        return alpha_g1.is_well_formed() && beta_g1.is_well_formed() && beta_g2.is_well_formed() &&
+                               delta_g1.is_well_formed() && delta_g2.is_well_formed() && check_points(A_query) &&
+                               check_points(B_query_values) && check_points(H_query) && check_points(L_query);
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_R1CS_GG_PPZKSNARK_MAPPED_PROVING_KEY_HPP
@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 =nil; Foundation
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_R1CS_GG_PPZKSNARK_PREPARED_PROVING_KEY_HPP
+#define CRYPTO3_R1CS_GG_PPZKSNARK_PREPARED_PROVING_KEY_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/proving_key.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/detail/fixed_base_multiexp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                /**
+                 * Proving key with fixed-base multiexp tables for its queries, built once and reused by every
+                 * proof with the key.
+                 *
+                 * The tables cost stripes_amount() times the memory of the queries on top of the key itself.
+                 * With a memory budget the number of stripes is the largest one that fits it, without one
+                 * the tables take default_stripes stripes.
+                 */
+                template<typename CurveType>
+                struct r1cs_gg_ppzksnark_prepared_proving_key : public r1cs_gg_ppzksnark_proving_key<CurveType> {
+                    typedef r1cs_gg_ppzksnark_proving_key<CurveType> proving_key_type;
+
+                    typedef typename CurveType::scalar_field_type scalar_field_type;
+                    typedef typename CurveType::template g1_type<> g1_type;
+                    typedef typename CurveType::template g2_type<> g2_type;
+
+                    typedef detail::fixed_base_multiexp_table<g1_type, scalar_field_type> g1_table_type;
+                    typedef detail::fixed_base_multiexp_table<g2_type, scalar_field_type> g2_table_type;
+
+                    g1_table_type A_table;
+                    g2_table_type B_g2_table;
+                    g1_table_type B_g1_table;
+                    g1_table_type H_table;
+                    g1_table_type L_table;
+
+                    // Number of stripes without a memory budget, the tables take 4 times the query memory
+                    constexpr static const std::size_t default_stripes = 4;
+
+                    explicit r1cs_gg_ppzksnark_prepared_proving_key(const proving_key_type &proving_key) :
+                        proving_key_type(proving_key) {
+                        prepare(default_stripes);
+                    }
+
+                    explicit r1cs_gg_ppzksnark_prepared_proving_key(proving_key_type &&proving_key) :
+                        proving_key_type(std::move(proving_key)) {
+                        prepare(default_stripes);
+                    }
+
+                    r1cs_gg_ppzksnark_prepared_proving_key(const proving_key_type &proving_key,
+                                                           std::size_t memory_budget) :
+                        proving_key_type(proving_key) {
+                        prepare(stripes_amount(*this, memory_budget));
+                    }
+
+                    r1cs_gg_ppzksnark_prepared_proving_key(proving_key_type &&proving_key,
+                                                           std::size_t memory_budget) :
+                        proving_key_type(std::move(proving_key)) {
+                        prepare(stripes_amount(*this, memory_budget));
+                    }
+
+                    std::size_t stripes_amount() const {
+                        return A_table.stripes_amount();
+                    }
+
+                    /*!
+                     * @brief Number of stripes of the tables of the proving key that fit in memory_budget bytes.
+                     */
+                    static std::size_t stripes_amount(const proving_key_type &proving_key,
+                                                      std::size_t memory_budget) {
+                        const std::size_t stripe_size =
+                            (proving_key.A_query.size() + proving_key.B_query.values.size() +
+                             proving_key.H_query.size() + proving_key.L_query.size()) *
+                                sizeof(typename g1_type::value_type) +
+                            proving_key.B_query.values.size() * sizeof(typename g2_type::value_type);
+
+                        const std::size_t stripes = stripe_size == 0 ? g1_table_type::max_stripes :
+                                                                       memory_budget / stripe_size;
+                        return std::max(std::size_t(1), std::min(stripes, g1_table_type::max_stripes));
+                    }
+
+                private:
+                    void prepare(std::size_t stripes) {
+                        std::vector<typename g2_type::value_type> B_g2;
+                        std::vector<typename g1_type::value_type> B_g1;
+                        B_g2.reserve(this->B_query.values.size());
+                        B_g1.reserve(this->B_query.values.size());
+                        for (const auto &value : this->B_query.values) {
+                            B_g2.emplace_back(value.g);
+                            B_g1.emplace_back(value.h);
+                        }
+
+                        A_table = g1_table_type(this->A_query.begin(), this->A_query.end(), stripes);
+                        B_g2_table = g2_table_type(B_g2.begin(), B_g2.end(), stripes);
+                        B_g1_table = g1_table_type(B_g1.begin(), B_g1.end(), stripes);
+                        H_table = g1_table_type(this->H_query.begin(), this->H_query.end(), stripes);
+                        L_table = g1_table_type(this->L_query.begin(), this->L_query.end(), stripes);
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_R1CS_GG_PPZKSNARK_PREPARED_PROVING_KEY_HPP
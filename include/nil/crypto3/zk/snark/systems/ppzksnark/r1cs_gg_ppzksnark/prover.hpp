@@ -39,6 +39,7 @@
 
 #include <nil/crypto3/zk/snark/reductions/r1cs_to_qap.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/detail/basic_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/detail/sparse_multiexp.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -47,6 +48,12 @@ namespace nil {
                 template<typename CurveType, proving_mode Mode = proving_mode::basic>
                 class r1cs_gg_ppzksnark_prover;
 
+                template<typename CurveType>
+                class r1cs_gg_ppzksnark_mapped_proving_key;
+
+                template<typename CurveType>
+                struct r1cs_gg_ppzksnark_prepared_proving_key;
+
                 /**
                  * A prover algorithm for the R1CS GG-ppzkSNARK.
                  *
@@ -70,15 +77,137 @@ namespace nil {
                     typedef typename policy_type::proving_key_type proving_key_type;
                     typedef typename policy_type::proof_type proof_type;
 
+                    typedef typename proving_key_type::constraint_system_type constraint_system_type;
+
                     static inline proof_type process(const proving_key_type &proving_key,
                                                      const primary_input_type &primary_input,
                                                      const auxiliary_input_type &auxiliary_input) {
+                        return prove(proving_key, proving_key.constraint_system, primary_input, auxiliary_input);
+                    }
+
+                    /*!
+                     * @brief Proves with a proving key loaded from the binary layout. The constraint
+                     * system is not stored in the binary layout, so it is passed separately.
+                     */
+                    static inline proof_type process(const r1cs_gg_ppzksnark_mapped_proving_key<CurveType> &proving_key,
+                                                     const constraint_system_type &constraint_system,
+                                                     const primary_input_type &primary_input,
+                                                     const auxiliary_input_type &auxiliary_input) {
+                        return prove(proving_key, constraint_system, primary_input, auxiliary_input);
+                    }
+
+                    /*!
+                     * @brief Proves with the fixed-base tables of a prepared proving key.
+                     */
+                    static inline proof_type
+                        process(const r1cs_gg_ppzksnark_prepared_proving_key<CurveType> &proving_key,
+                                const primary_input_type &primary_input,
+                                const auxiliary_input_type &auxiliary_input) {
+                        return prove(proving_key, proving_key.constraint_system, primary_input, auxiliary_input);
+                    }
+
+                private:
+                    template<typename ProvingKey, typename InputFieldIterator>
+                    static inline typename g1_type::value_type evaluate_A_query(const ProvingKey &proving_key,
+                                                                                InputFieldIterator first,
+                                                                                InputFieldIterator last,
+                                                                                std::size_t chunks) {
+                        return detail::sparse_multiexp<algebra::policies::multiexp_method_BDLO12>(
+                            proving_key.A_query.begin(), proving_key.A_query.end(), first, last, chunks);
+                    }
+
+                    template<typename InputFieldIterator>
+                    static inline typename g1_type::value_type
+                        evaluate_A_query(const r1cs_gg_ppzksnark_prepared_proving_key<CurveType> &proving_key,
+                                         InputFieldIterator first, InputFieldIterator last, std::size_t chunks) {
+                        return proving_key.A_table.eval(first, last, chunks);
+                    }
+
+                    // The coefficients of H are dense, they do not go through the sparse path
+                    template<typename ProvingKey, typename InputFieldIterator>
+                    static inline typename g1_type::value_type evaluate_H_query(const ProvingKey &proving_key,
+                                                                                InputFieldIterator first,
+                                                                                InputFieldIterator last,
+                                                                                std::size_t chunks) {
+                        return algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
+                            proving_key.H_query.begin(), proving_key.H_query.begin() + std::distance(first, last),
+                            first, last, chunks);
+                    }
+
+                    template<typename InputFieldIterator>
+                    static inline typename g1_type::value_type
+                        evaluate_H_query(const r1cs_gg_ppzksnark_prepared_proving_key<CurveType> &proving_key,
+                                         InputFieldIterator first, InputFieldIterator last, std::size_t chunks) {
+                        return proving_key.H_table.eval(first, last, chunks);
+                    }
+
+                    template<typename ProvingKey, typename InputFieldIterator>
+                    static inline typename g1_type::value_type evaluate_L_query(const ProvingKey &proving_key,
+                                                                                InputFieldIterator first,
+                                                                                InputFieldIterator last,
+                                                                                std::size_t chunks) {
+                        return detail::sparse_multiexp<algebra::policies::multiexp_method_BDLO12>(
+                            proving_key.L_query.begin(), proving_key.L_query.end(), first, last, chunks);
+                    }
+
+                    template<typename InputFieldIterator>
+                    static inline typename g1_type::value_type
+                        evaluate_L_query(const r1cs_gg_ppzksnark_prepared_proving_key<CurveType> &proving_key,
+                                         InputFieldIterator first, InputFieldIterator last, std::size_t chunks) {
+                        return proving_key.L_table.eval(first, last, chunks);
+                    }
+
+                    static inline typename commitments::knowledge_commitment<g2_type, g1_type>::value_type
+                        evaluate_B_query(const proving_key_type &proving_key,
+                                         const std::vector<typename scalar_field_type::value_type> &assignment,
+                                         std::size_t size,
+                                         std::size_t chunks) {
+                        return commitments::kc_multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
+                            proving_key.B_query, 0, size, assignment.begin(), assignment.begin() + size, chunks);
+                    }
+
+                    static inline typename commitments::knowledge_commitment<g2_type, g1_type>::value_type
+                        evaluate_B_query(const r1cs_gg_ppzksnark_mapped_proving_key<CurveType> &proving_key,
+                                         const std::vector<typename scalar_field_type::value_type> &assignment,
+                                         std::size_t size,
+                                         std::size_t chunks) {
+                        return commitments::kc_multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12,
+                                                                            g2_type, g1_type>(
+                            proving_key.B_query_domain_size, proving_key.B_query_indices.begin(),
+                            proving_key.B_query_indices.end(), proving_key.B_query_values.begin(), 0, size,
+                            assignment.begin(), assignment.begin() + size, chunks);
+                    }
+
+                    static inline typename commitments::knowledge_commitment<g2_type, g1_type>::value_type
+                        evaluate_B_query(const r1cs_gg_ppzksnark_prepared_proving_key<CurveType> &proving_key,
+                                         const std::vector<typename scalar_field_type::value_type> &assignment,
+                                         std::size_t size,
+                                         std::size_t chunks) {
+                        // The tables hold the non-zero entries of B_query, the scalars are gathered to match
+                        std::vector<typename scalar_field_type::value_type> scalars;
+                        for (std::size_t index : proving_key.B_query.indices) {
+                            if (index >= size) {
+                                break;
+                            }
+                            scalars.emplace_back(assignment[index]);
+                        }
+
+                        return typename commitments::knowledge_commitment<g2_type, g1_type>::value_type(
+                            proving_key.B_g2_table.eval(scalars.begin(), scalars.end(), chunks),
+                            proving_key.B_g1_table.eval(scalars.begin(), scalars.end(), chunks));
+                    }
+
+                    template<typename ProvingKey>
+                    static inline proof_type prove(const ProvingKey &proving_key,
+                                                   const constraint_system_type &constraint_system,
+                                                   const primary_input_type &primary_input,
+                                                   const auxiliary_input_type &auxiliary_input) {
 
-                        BOOST_ASSERT(proving_key.constraint_system.is_satisfied(primary_input, auxiliary_input));
+                        BOOST_ASSERT(constraint_system.is_satisfied(primary_input, auxiliary_input));
 
                         const qap_witness<scalar_field_type> qap_wit =
                             reductions::r1cs_to_qap<scalar_field_type>::witness_map(
-                                proving_key.constraint_system, primary_input, auxiliary_input,
+                                constraint_system, primary_input, auxiliary_input,
                                 scalar_field_type::value_type::zero(), scalar_field_type::value_type::zero(),
                                 scalar_field_type::value_type::zero());
 
@@ -106,37 +235,25 @@ namespace nil {
                                                        qap_wit.coefficients_for_ABCs.end());
 
                         typename g1_type::value_type evaluation_At =
-                            algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
-                                proving_key.A_query.begin(),
-                                proving_key.A_query.begin() + qap_wit.num_variables + 1,
-                                const_padded_assignment.begin(),
-                                const_padded_assignment.begin() + qap_wit.num_variables + 1,
-                                chunks);
+                            evaluate_A_query(proving_key,
+                                             const_padded_assignment.begin(),
+                                             const_padded_assignment.begin() + qap_wit.num_variables + 1,
+                                             chunks);
 
                         typename commitments::knowledge_commitment<g2_type, g1_type>::value_type evaluation_Bt =
-                            commitments::kc_multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
-                                proving_key.B_query,
-                                0,
-                                qap_wit.num_variables + 1,
-                                const_padded_assignment.begin(),
-                                const_padded_assignment.begin() + qap_wit.num_variables + 1,
-                                chunks);
+                            evaluate_B_query(proving_key, const_padded_assignment, qap_wit.num_variables + 1, chunks);
 
                         typename g1_type::value_type evaluation_Ht =
-                            algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
-                                proving_key.H_query.begin(),
-                                proving_key.H_query.begin() + (qap_wit.degree - 1),
-                                qap_wit.coefficients_for_H.begin(),
-                                qap_wit.coefficients_for_H.begin() + (qap_wit.degree - 1),
-                                chunks);
+                            evaluate_H_query(proving_key,
+                                             qap_wit.coefficients_for_H.begin(),
+                                             qap_wit.coefficients_for_H.begin() + (qap_wit.degree - 1),
+                                             chunks);
 
                         typename g1_type::value_type evaluation_Lt =
-                            algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
-                                proving_key.L_query.begin(),
-                                proving_key.L_query.end(),
-                                const_padded_assignment.begin() + qap_wit.num_inputs + 1,
-                                const_padded_assignment.begin() + qap_wit.num_variables + 1,
-                                chunks);
+                            evaluate_L_query(proving_key,
+                                             const_padded_assignment.begin() + qap_wit.num_inputs + 1,
+                                             const_padded_assignment.begin() + qap_wit.num_variables + 1,
+                                             chunks);
 
                         /* A = alpha + sum_i(a_i*A_i(t)) + r*delta */
                         typename g1_type::value_type g1_A =
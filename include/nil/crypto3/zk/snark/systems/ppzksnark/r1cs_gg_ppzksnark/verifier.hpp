@@ -50,9 +50,18 @@
 #ifndef CRYPTO3_ZK_R1CS_GG_PPZKSNARK_BASIC_VERIFIER_HPP
 #define CRYPTO3_ZK_R1CS_GG_PPZKSNARK_BASIC_VERIFIER_HPP
 
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/random/random_device.hpp>
+
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/container/accumulation_vector.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/multi_pair.hpp>
 #include <nil/crypto3/zk/commitments/polynomial/knowledge_commitment.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
 #include <nil/crypto3/zk/snark/reductions/r1cs_to_qap.hpp>
@@ -74,6 +83,9 @@ namespace nil {
                 template<typename CurveType, proving_mode Mode = proving_mode::basic>
                 class r1cs_gg_ppzksnark_verifier_strong_input_consistency;
 
+                template<typename CurveType, proving_mode Mode = proving_mode::basic>
+                class r1cs_gg_ppzksnark_batch_verifier;
+
                 /**
                  * Convert a (non-processed) verification key into a processed verification key.
                  */
@@ -230,6 +242,224 @@ namespace nil {
                     }
                 };
 
+                /**
+                 * Batch verifier for the R1CS GG-ppzkSNARK with strong input consistency.
+                 *
+                 * Every proof i is scaled by a random non-zero r_i and the verification equations are
+                 * folded into one:
+                 *
+                 * prod_i e(r_i * A_i, B_i) = prod_vk e(alpha, beta)^(sum r_i) * e(sum r_i * acc_i, gamma) *
+                 *                            e(sum r_i * C_i, delta)
+                 *
+                 * Proofs sharing a verification key object share the gamma and delta pairings, and their input
+                 * accumulations are merged into one gamma_ABC_g1 multiexponentiation over sum r_i * x_i.
+                 * The (r_i * A_i, B_i) pairs go through one commitments::detail::multi_miller_loop, and all
+                 * Miller loop outputs are multiplied together before a single final exponentiation.
+                 * A batch with an invalid proof is accepted only with negligible probability, but the
+                 * result does not tell which proof is invalid.
+                 */
+                template<typename CurveType>
+                class r1cs_gg_ppzksnark_batch_verifier<CurveType, proving_mode::basic> {
+                    typedef detail::r1cs_gg_ppzksnark_basic_policy<CurveType, proving_mode::basic> policy_type;
+
+                    typedef typename CurveType::scalar_field_type scalar_field_type;
+                    typedef typename CurveType::template g1_type<> g1_type;
+                    typedef typename CurveType::template g2_type<> g2_type;
+                    typedef typename CurveType::gt_type gt_type;
+
+                    typedef typename scalar_field_type::value_type scalar_field_value_type;
+                    typedef typename g1_type::value_type g1_value_type;
+                    typedef typename g2_type::value_type g2_value_type;
+                    typedef typename gt_type::value_type gt_value_type;
+
+                public:
+                    typedef typename policy_type::primary_input_type primary_input_type;
+                    typedef typename policy_type::verification_key_type verification_key_type;
+                    typedef typename policy_type::processed_verification_key_type processed_verification_key_type;
+                    typedef typename policy_type::proof_type proof_type;
+
+                    /**
+                     * A batch verifier algorithm for the R1CS GG-ppzkSNARK that:
+                     * (1) accepts a non-processed verification key shared by all proofs, and
+                     * (2) has strong input consistency.
+                     */
+                    template<typename PrimaryInputRange, typename ProofRange, typename RNG = boost::random_device>
+                    static inline bool process(const verification_key_type &verification_key,
+                                               const PrimaryInputRange &primary_inputs,
+                                               const ProofRange &proofs,
+                                               RNG &&rng = boost::random_device()) {
+                        return process(r1cs_gg_ppzksnark_process_verification_key<CurveType>::process(verification_key),
+                                       primary_inputs, proofs, rng);
+                    }
+
+                    /**
+                     * A batch verifier algorithm for the R1CS GG-ppzkSNARK that:
+                     * (1) accepts a processed verification key shared by all proofs, and
+                     * (2) has strong input consistency.
+                     */
+                    template<typename PrimaryInputRange, typename ProofRange, typename RNG = boost::random_device>
+                    static inline bool process(const processed_verification_key_type &processed_verification_key,
+                                               const PrimaryInputRange &primary_inputs,
+                                               const ProofRange &proofs,
+                                               RNG &&rng = boost::random_device()) {
+                        BOOST_ASSERT(std::distance(std::begin(primary_inputs), std::end(primary_inputs)) ==
+                                     std::distance(std::begin(proofs), std::end(proofs)));
+
+                        if (std::begin(proofs) == std::end(proofs)) {
+                            return true;
+                        }
+
+                        std::vector<key_accumulator> key_accumulators;
+                        key_accumulators.emplace_back(processed_verification_key);
+                        proof_pairs pairs(std::distance(std::begin(proofs), std::end(proofs)));
+
+                        auto proof_it = std::begin(proofs);
+                        for (auto input_it = std::begin(primary_inputs); input_it != std::end(primary_inputs);
+                             ++input_it, ++proof_it) {
+                            if (!fold(key_accumulators.front(), *input_it, *proof_it, derive_non_zero(rng), pairs)) {
+                                return false;
+                            }
+                        }
+
+                        return check(key_accumulators, pairs);
+                    }
+
+                    /**
+                     * A batch verifier algorithm for the R1CS GG-ppzkSNARK that:
+                     * (1) accepts a processed verification key per proof, and
+                     * (2) has strong input consistency.
+                     */
+                    template<typename VerificationKeyRange, typename PrimaryInputRange, typename ProofRange,
+                             typename RNG = boost::random_device>
+                    static inline typename std::enable_if<
+                        std::is_same<processed_verification_key_type,
+                                     typename std::iterator_traits<
+                                         typename VerificationKeyRange::const_iterator>::value_type>::value,
+                        bool>::type
+                        process(const VerificationKeyRange &processed_verification_keys,
+                                const PrimaryInputRange &primary_inputs,
+                                const ProofRange &proofs,
+                                RNG &&rng = boost::random_device()) {
+                        BOOST_ASSERT(std::distance(std::begin(processed_verification_keys),
+                                                   std::end(processed_verification_keys)) ==
+                                     std::distance(std::begin(proofs), std::end(proofs)));
+                        BOOST_ASSERT(std::distance(std::begin(primary_inputs), std::end(primary_inputs)) ==
+                                     std::distance(std::begin(proofs), std::end(proofs)));
+
+                        std::vector<key_accumulator> key_accumulators;
+                        // proofs are grouped by the address of their key, equal keys stored apart are not merged
+                        std::unordered_map<const processed_verification_key_type *, std::size_t> key_indices;
+                        proof_pairs pairs(std::distance(std::begin(proofs), std::end(proofs)));
+
+                        auto input_it = std::begin(primary_inputs);
+                        auto proof_it = std::begin(proofs);
+                        for (auto key_it = std::begin(processed_verification_keys);
+                             key_it != std::end(processed_verification_keys);
+                             ++key_it, ++input_it, ++proof_it) {
+                            const auto key_index = key_indices.emplace(&*key_it, key_accumulators.size());
+                            if (key_index.second) {
+                                key_accumulators.emplace_back(*key_it);
+                            }
+
+                            if (!fold(key_accumulators[key_index.first->second], *input_it, *proof_it,
+                                      derive_non_zero(rng), pairs)) {
+                                return false;
+                            }
+                        }
+
+                        return check(key_accumulators, pairs);
+                    }
+
+                private:
+                    struct key_accumulator {
+                        explicit key_accumulator(const processed_verification_key_type &pvk) :
+                            pvk(pvk), r_sum(scalar_field_value_type::zero()),
+                            input_coefficients(pvk.gamma_ABC_g1.domain_size(), scalar_field_value_type::zero()),
+                            c_sum(g1_value_type::zero()) {
+                        }
+
+                        const processed_verification_key_type &pvk;
+                        // sum r_i over the proofs of this key
+                        scalar_field_value_type r_sum;
+                        // sum r_i * x_i over the primary inputs of this key
+                        std::vector<scalar_field_value_type> input_coefficients;
+                        // sum r_i * C_i over the proofs of this key
+                        g1_value_type c_sum;
+                    };
+
+                    struct proof_pairs {
+                        explicit proof_pairs(std::size_t proofs_number) {
+                            scaled_a.reserve(proofs_number);
+                            b.reserve(proofs_number);
+                        }
+
+                        // r_i * A_i and B_i, paired by the Miller loop of check
+                        std::vector<g1_value_type> scaled_a;
+                        std::vector<g2_value_type> b;
+                    };
+
+                    template<typename RNG>
+                    static inline scalar_field_value_type derive_non_zero(RNG &rng) {
+                        scalar_field_value_type r = algebra::random_element<scalar_field_type>(rng);
+                        while (r.is_zero()) {
+                            r = algebra::random_element<scalar_field_type>(rng);
+                        }
+                        return r;
+                    }
+
+                    static inline bool fold(key_accumulator &key_acc,
+                                            const primary_input_type &primary_input,
+                                            const proof_type &proof,
+                                            const scalar_field_value_type &r,
+                                            proof_pairs &pairs) {
+                        if (key_acc.pvk.gamma_ABC_g1.domain_size() != primary_input.size() ||
+                            !proof.is_well_formed()) {
+                            return false;
+                        }
+
+                        pairs.scaled_a.emplace_back(r * proof.g_A);
+                        pairs.b.emplace_back(proof.g_B);
+
+                        key_acc.r_sum = key_acc.r_sum + r;
+                        for (std::size_t i = 0; i < primary_input.size(); ++i) {
+                            key_acc.input_coefficients[i] = key_acc.input_coefficients[i] + r * primary_input[i];
+                        }
+                        key_acc.c_sum = key_acc.c_sum + r * proof.g_C;
+
+                        return true;
+                    }
+
+                    static inline bool check(const std::vector<key_accumulator> &key_accumulators,
+                                             const proof_pairs &pairs) {
+                        const gt_value_type proofs_miller = commitments::detail::multi_pair<CurveType>(
+                            pairs.scaled_a.begin(), pairs.scaled_a.end(), pairs.b.begin(), pairs.b.end());
+
+                        gt_value_type keys_miller = gt_value_type::one();
+                        gt_value_type expected = gt_value_type::one();
+
+                        for (const key_accumulator &key_acc : key_accumulators) {
+                            // sum r_i * acc_i = (sum r_i) * gamma_ABC_0 + sum_j (sum r_i * x_ij) * gamma_ABC_j
+                            const g1_value_type acc =
+                                key_acc.pvk.gamma_ABC_g1.first * key_acc.r_sum +
+                                (key_acc.pvk.gamma_ABC_g1
+                                     .accumulate_chunk(key_acc.input_coefficients.begin(),
+                                                       key_acc.input_coefficients.end(), 0)
+                                     .first -
+                                 key_acc.pvk.gamma_ABC_g1.first);
+
+                            keys_miller = keys_miller * double_miller_loop<CurveType>(
+                                                            precompute_g1<CurveType>(acc),
+                                                            key_acc.pvk.vk_gamma_g2_precomp,
+                                                            precompute_g1<CurveType>(key_acc.c_sum),
+                                                            key_acc.pvk.vk_delta_g2_precomp);
+                            expected = expected * key_acc.pvk.vk_alpha_g1_beta_g2.pow(key_acc.r_sum.data);
+                        }
+
+                        return final_exponentiation<CurveType>(proofs_miller * keys_miller.unitary_inversed()) ==
+                               expected;
+                    }
+                };
+
                 // /**
                 //  *
                 //  * A verifier algorithm for the R1CS GG-ppzkSNARK that:
@@ -27,6 +27,11 @@
 #ifndef CRYPTO3_ZK_TRANSCRIPT_FIAT_SHAMIR_HEURISTIC_HPP
 #define CRYPTO3_ZK_TRANSCRIPT_FIAT_SHAMIR_HEURISTIC_HPP
 
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
 #include <nil/marshalling/algorithms/pack.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 
@@ -184,6 +189,117 @@ namespace nil {
                 private:
                     typename hash_type::digest_type state;
                 };
+
+                /*!
+                 * @brief Fiat–Shamir heuristic over a running hash state.
+                 *
+                 * Absorbed data is appended to an open hash accumulator, the state is finalized only when
+                 * a challenge is squeezed. The digest becomes the challenge and seeds the accumulator of the
+                 * following absorbs, so consecutive absorbs cost only the hashing of the absorbed bytes.
+                 * Every absorb is framed by its length (a 64-bit big-endian count of the absorbed values), so
+                 * different splits of the same data give different challenges. Field elements are absorbed in
+                 * their big-endian encoding through a reused buffer, and challenges are imported from the digest
+                 * bytes without marshalling.
+                 *
+                 * It is not interchangeable with fiat_shamir_heuristic_sequential: the same data yields
+                 * other challenges, so prover and verifier have to use the same transcript.
+                 */
+                template<typename Hash>
+                class fiat_shamir_heuristic_sponge {
+                public:
+                    typedef Hash hash_type;
+                    typedef typename hash_type::digest_type digest_type;
+
+                    fiat_shamir_heuristic_sponge() : acc() {
+                    }
+
+                    template<typename InputRange>
+                    fiat_shamir_heuristic_sponge(const InputRange &r) : acc() {
+                        (*this)(r);
+                    }
+
+                    template<typename InputIterator>
+                    fiat_shamir_heuristic_sponge(InputIterator first, InputIterator last) : acc() {
+                        (*this)(first, last);
+                    }
+
+                    template<typename InputRange>
+                    void operator()(const InputRange &r) {
+                        absorb_length(std::distance(std::begin(r), std::end(r)));
+                        hash<hash_type>(r, acc);
+                    }
+
+                    template<typename InputIterator>
+                    void operator()(InputIterator first, InputIterator last) {
+                        absorb_length(std::distance(first, last));
+                        hash<hash_type>(first, last, acc);
+                    }
+
+                    template<typename FieldValueType>
+                    void absorb(const FieldValueType &value) {
+                        using field_element_type = nil::crypto3::marshalling::types::field_element<
+                            nil::marshalling::field_type<nil::marshalling::option::big_endian>, FieldValueType>;
+
+                        field_element_type element(value);
+                        buffer.resize(element.length());
+                        auto write_iter = buffer.begin();
+                        element.write(write_iter, buffer.size());
+                        (*this)(buffer);
+                    }
+
+                    template<typename Field>
+                    typename Field::value_type challenge() {
+                        const digest_type digest = squeeze();
+
+                        nil::crypto3::multiprecision::cpp_int raw_result;
+                        nil::crypto3::multiprecision::import_bits(raw_result, digest.begin(), digest.end());
+
+                        return raw_result;
+                    }
+
+                    template<typename Integral>
+                    Integral int_challenge() {
+                        const digest_type digest = squeeze();
+
+                        Integral result = 0;
+                        for (std::size_t i = 0; i < sizeof(Integral) && i < digest.size(); i++) {
+                            result = (result << 8) | static_cast<Integral>(digest[i]);
+                        }
+
+                        return result;
+                    }
+
+                    template<typename Field, std::size_t N>
+                    std::array<typename Field::value_type, N> challenges() {
+
+                        std::array<typename Field::value_type, N> result;
+                        for (auto &ch : result) {
+                            ch = challenge<Field>();
+                        }
+
+                        return result;
+                    }
+
+                private:
+                    void absorb_length(std::uint64_t length) {
+                        std::array<std::uint8_t, sizeof(std::uint64_t)> prefix;
+                        for (std::size_t i = prefix.size(); i > 0; i--) {
+                            prefix[i - 1] = static_cast<std::uint8_t>(length);
+                            length >>= 8;
+                        }
+                        hash<hash_type>(prefix, acc);
+                    }
+
+                    digest_type squeeze() {
+                        digest_type digest = accumulators::extract::hash<hash_type>(acc);
+                        acc = accumulator_set<hash_type>();
+                        hash<hash_type>(digest, acc);
+                        return digest;
+                    }
+
+                    accumulator_set<hash_type> acc;
+                    std::vector<std::uint8_t> buffer;
+                };
             }    // namespace transcript
         }        // namespace zk
     }            // namespace crypto3
@@ -139,6 +139,58 @@ BOOST_AUTO_TEST_CASE(fri_basic_test) {
     BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
 }
 
+BOOST_AUTO_TEST_CASE(fri_sponge_transcript_test) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+    typedef zk::transcript::fiat_shamir_heuristic_sponge<transcript_hash_type> transcript_type;
+
+    constexpr static const std::size_t d = 16;
+
+    constexpr static const std::size_t r = boost::static_log2<d>::value;
+    constexpr static const std::size_t m = 2;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m, 1, true, transcript_type>
+        fri_type;
+
+    static_assert(std::is_same<typename fri_type::transcript_type, transcript_type>::value);
+
+    typedef typename fri_type::proof_type proof_type;
+    typedef typename fri_type::params_type params_type;
+
+    params_type params;
+
+    std::size_t extended_log = boost::static_log2<d>::value;
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(extended_log, r);
+
+    params.r = r;
+    params.D = D;
+    params.max_degree = d - 1;
+    params.step_list = generate_random_step_list(r, 1);
+
+    math::polynomial<typename FieldType::value_type> f = {1, 3, 4, 1, 5, 6, 7, 2, 8, 7, 5, 6, 1, 2, 1, 1};
+
+    // eval
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    transcript_type transcript(init_blob);
+
+    proof_type proof = zk::algorithms::proof_eval<fri_type>(f, params, transcript);
+
+    // verify
+    transcript_type transcript_verifier(init_blob);
+
+    BOOST_CHECK(zk::algorithms::verify_eval<fri_type>(proof, params, proof.round_proofs[0].T_root, transcript_verifier));
+
+    typename FieldType::value_type verifier_next_challenge = transcript_verifier.template challenge<FieldType>();
+    typename FieldType::value_type prover_next_challenge = transcript.template challenge<FieldType>();
+    BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
+}
+
 BOOST_AUTO_TEST_CASE(fri_basic_skipping_layers_test) {
 
     // setup
@@ -244,6 +296,66 @@ BOOST_AUTO_TEST_CASE(fri_steps_count_test) {
     BOOST_CHECK_EQUAL(proof.final_polynomials[0].degree(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(fri_precommit_leaf_layout_test) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+
+    constexpr static const std::size_t d = 16;
+
+    constexpr static const std::size_t r = boost::static_log2<d>::value;
+    constexpr static const std::size_t m = 2;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m, 1, true> fri_type;
+
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(boost::static_log2<d>::value, r);
+
+    math::polynomial<typename FieldType::value_type> f_data = {1, 3, 4, 1, 5, 6, 7, 2, 8, 7, 5, 6, 1, 2, 1, 1};
+    math::polynomial_dfs<typename FieldType::value_type> f;
+    f.from_coefficients(f_data);
+
+    // single and batched precommitments have to produce the same leaves for any coset size,
+    // also when the leaves buffer is reused between commitments
+    typename fri_type::leaves_buffer_type leaves;
+    for (std::size_t fri_step = 1; fri_step < r; fri_step++) {
+        std::array<math::polynomial_dfs<typename FieldType::value_type>, 1> batch = {f};
+        auto single_tree = zk::algorithms::precommit<fri_type>(f, D[0], fri_step);
+        auto batched_tree = zk::algorithms::precommit<fri_type>(batch, D[0], fri_step);
+        auto reused_tree = zk::algorithms::precommit<fri_type>(batch, D[0], fri_step, leaves);
+
+        BOOST_CHECK_EQUAL(single_tree.leaves(), d >> fri_step);
+        BOOST_CHECK_EQUAL(leaves.leaves(), d >> fri_step);
+        BOOST_CHECK(zk::algorithms::commit<fri_type>(single_tree) == zk::algorithms::commit<fri_type>(batched_tree));
+        BOOST_CHECK(zk::algorithms::commit<fri_type>(single_tree) == zk::algorithms::commit<fri_type>(reused_tree));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fri_parallel_merkle_tree_test) {
+
+    typedef hashes::sha2<256> merkle_hash_type;
+
+    // The level by level tree has to match the one of the containers library
+    for (std::size_t leaves_number : {1, 2, 8, 64}) {
+        std::vector<std::vector<std::uint8_t>> leaves(leaves_number);
+        for (std::size_t i = 0; i < leaves_number; i++) {
+            for (std::size_t j = 0; j < 3 * i + 1; j++) {
+                leaves[i].push_back(static_cast<std::uint8_t>(i * 31 + j));
+            }
+        }
+
+        auto expected = containers::make_merkle_tree<merkle_hash_type, 2>(leaves.begin(), leaves.end());
+        auto actual = zk::commitments::detail::make_merkle_tree<merkle_hash_type, 2>(leaves.begin(), leaves.end());
+
+        BOOST_CHECK_EQUAL(actual.leaves(), expected.leaves());
+        BOOST_CHECK(actual.root() == expected.root());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(batched_fri_test_suite)
@@ -911,4 +1023,75 @@ BOOST_AUTO_TEST_CASE(batched_fri_dfs_test_2) {
     BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
 }
 
+BOOST_AUTO_TEST_CASE(batched_fri_multi_query_test) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+
+    constexpr static const std::size_t d = 16;
+
+    constexpr static const std::size_t r = boost::static_log2<d>::value;
+    constexpr static const std::size_t m = 2;
+    constexpr static const std::size_t leaf_size = 2;
+    constexpr static const bool is_const_size = true;
+    constexpr static const std::size_t queries_number = 5;
+
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m, leaf_size, is_const_size> fri_type;
+
+    typedef typename fri_type::proof_type proof_type;
+    typedef typename fri_type::params_type params_type;
+
+    params_type params;
+
+    constexpr static const std::size_t d_extended = d;
+    std::size_t extended_log = boost::static_log2<d_extended>::value;
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(extended_log, r);
+
+    params.r = r;
+    params.D = D;
+    params.max_degree = d - 1;
+    params.step_list = generate_random_step_list(r, 3);
+
+    // commit
+    std::array<math::polynomial<typename FieldType::value_type>, leaf_size> f = {
+        {{1, 3, 4, 1, 5, 6, 7, 2, 8, 7, 5, 6, 1, 2, 1, 1}, {1, 3, 4, 1, 5, 6, 7, 2, 8, 7, 7, 7, 7, 2, 1, 1}}};
+
+    typename fri_type::precommitment_type tree =
+        zk::algorithms::precommit<fri_type>(f, params.D[0], params.step_list[0]);
+
+    // eval
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(init_blob);
+
+    std::vector<proof_type> proofs =
+        zk::algorithms::multi_query_proof_eval<fri_type>(f, f, tree, params, queries_number, transcript);
+    BOOST_CHECK_EQUAL(proofs.size(), queries_number);
+
+    // all queries open the same folded layers
+    for (std::size_t query_id = 1; query_id < queries_number; query_id++) {
+        BOOST_CHECK_EQUAL(proofs[query_id].round_proofs.size(), proofs[0].round_proofs.size());
+        for (std::size_t i = 0; i < proofs[0].round_proofs.size(); i++) {
+            BOOST_CHECK(proofs[query_id].round_proofs[i].T_root == proofs[0].round_proofs[i].T_root);
+        }
+        BOOST_CHECK(proofs[query_id].final_polynomials == proofs[0].final_polynomials);
+    }
+
+    // verify
+    zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(init_blob);
+
+    std::array<math::polynomial<typename FieldType::value_type>, 1> U = {{{0}}};
+    std::array<math::polynomial<typename FieldType::value_type>, 1> V = {{{1}}};
+    BOOST_CHECK(zk::algorithms::multi_query_verify_eval<fri_type>(proofs, params, zk::algorithms::commit<fri_type>(tree),
+                                                                  U, V, transcript_verifier));
+
+    typename FieldType::value_type verifier_next_challenge = transcript_verifier.template challenge<FieldType>();
+    typename FieldType::value_type prover_next_challenge = transcript.template challenge<FieldType>();
+    BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
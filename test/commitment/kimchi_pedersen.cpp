@@ -5,6 +5,7 @@
 #include <cassert>
 #include <chrono>
 #include <cstdlib>
+#include <sstream>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -15,6 +16,7 @@
 #include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
 
 #include <nil/crypto3/zk/commitments/polynomial/kimchi_pedersen.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/pickles/detail/mapping.hpp>
@@ -251,4 +253,102 @@ BOOST_AUTO_TEST_CASE(kimchi_commitment_test_case){
     BOOST_CHECK(kimchi_pedersen::verify_eval(params, g_map, batch));
 }
 
+BOOST_AUTO_TEST_CASE(kimchi_commitment_test_batch_verifier){
+    snark::group_map<curve_type> g_map;
+    params_type params = kimchi_pedersen::setup(20);
+    kimchi_pedersen::batch_verifier verifier(params, g_map);
+
+    std::vector<scalar_value_type> coeffs;
+    for(int i = 0; i < 10; ++i){
+        coeffs.emplace_back(i);
+    }
+    math::polynomial<scalar_value_type> poly(coeffs);
+    chunked_polynomial poly_chunked(poly, params.g.size());
+
+    std::vector<batchproof_type> batch;
+    for(int i = 0; i < 3; ++i){
+        sponge_type fq_sponge;
+        blinded_commitment_type commitment = kimchi_pedersen::commitment(params, poly, -1);
+        scalar_value_type u = algebra::random_element<scalar_field_type>();
+        scalar_value_type v = algebra::random_element<scalar_field_type>();
+        std::vector<scalar_value_type> elm{algebra::random_element<scalar_field_type>()};
+        poly_type polys{{poly, -1, std::get<1>(commitment)}};
+
+        proof_type proof = kimchi_pedersen::proof_eval(params, g_map, polys, elm, v, u, fq_sponge);
+
+        std::vector<std::vector<scalar_value_type>> chunked_evals = {poly_chunked.evaluate_chunks(elm[0])};
+        std::vector<evaluation_type> evals;
+        evals.emplace_back(std::get<0>(commitment), chunked_evals, -1);
+        sponge_type new_fq_sponge;
+        batch.emplace_back(new_fq_sponge, evals, elm, v, u, proof);
+    }
+
+    for(auto &b : batch){
+        BOOST_CHECK(!verifier.ready(batch.size(), std::chrono::hours(1)));
+        verifier.add(b);
+    }
+    BOOST_CHECK(verifier.ready(batch.size(), std::chrono::hours(1)));
+    BOOST_CHECK(verifier.verify());
+    BOOST_CHECK_EQUAL(verifier.size(), 0);
+
+    // One wrong opening fails the whole batch
+    batch[1].opening.z1 += scalar_value_type::one();
+    for(auto &b : batch){
+        verifier.add(b);
+    }
+    BOOST_CHECK(!verifier.verify());
+
+    // The next batch, checked with freshly drawn random bases, verifies again
+    batch[1].opening.z1 -= scalar_value_type::one();
+    for(auto &b : batch){
+        verifier.add(b);
+    }
+    BOOST_CHECK(verifier.verify());
+}
+
+BOOST_AUTO_TEST_CASE(kimchi_commitment_test_lagrange_bases){
+    params_type params = kimchi_pedersen::setup(20);
+    math::basic_radix2_domain<scalar_field_type> domain(16);
+
+    params.add_lagrange_basis(domain);
+    BOOST_REQUIRE(params.lagrange_bases.find(16) != params.lagrange_bases.end());
+
+    std::vector<group_type::value_type> expected(params.g.begin(), params.g.begin() + 16);
+    domain.inverse_fft(expected);
+    BOOST_CHECK(params.lagrange_bases[16] == expected);
+
+    std::vector<group_type::value_type> srs = params.lagrange_bases[16];
+    commitments::detail::group_fft(srs, domain.omega);
+    BOOST_CHECK(std::equal(srs.begin(), srs.end(), params.g.begin()));
+
+    std::stringstream cache;
+    BOOST_CHECK(params.save_lagrange_bases(cache));
+
+    params_type loaded_params = params;
+    loaded_params.lagrange_bases.clear();
+    BOOST_CHECK(loaded_params.load_lagrange_bases(cache));
+    BOOST_CHECK(loaded_params.lagrange_bases == params.lagrange_bases);
+
+    // A cache of another SRS of the same size is rejected
+    std::stringstream other_srs_cache;
+    params.save_lagrange_bases(other_srs_cache);
+    params_type other_params = kimchi_pedersen::setup(20);
+    BOOST_CHECK(!other_params.load_lagrange_bases(other_srs_cache));
+    BOOST_CHECK(other_params.lagrange_bases.empty());
+
+    std::stringstream other_h_cache;
+    params.save_lagrange_bases(other_h_cache);
+    other_params = params;
+    other_params.lagrange_bases.clear();
+    other_params.h = other_params.h + group_type::value_type::one();
+    BOOST_CHECK(!other_params.load_lagrange_bases(other_h_cache));
+
+    // A cache of a truncated SRS is rejected
+    std::stringstream small_srs_cache;
+    params.save_lagrange_bases(small_srs_cache);
+    loaded_params.g.resize(8);
+    loaded_params.lagrange_bases.clear();
+    BOOST_CHECK(!loaded_params.load_lagrange_bases(small_srs_cache));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
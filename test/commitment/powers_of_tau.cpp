@@ -1,5 +1,7 @@
 #define BOOST_TEST_MODULE powers_of_tau_test
 
+#include <sstream>
+
 #include <boost/test/unit_test.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
@@ -149,9 +151,70 @@ BOOST_AUTO_TEST_CASE(powers_of_tau_basic_test) {
     auto beacon_pubkey_reproduced = scheme_type::proof_eval(beacon_sk_reproduced, acc2, rng_reproduced);
     BOOST_CHECK(scheme_type::verify_eval(beacon_pubkey_reproduced, acc2, acc3));
 
+    // A single wrong power must fail the batched ratio checks
+    auto acc3_tampered = acc3;
+    acc3_tampered.tau_powers_g1[7] = acc3_tampered.tau_powers_g1[7] + acc3_tampered.tau_powers_g1[0];
+    BOOST_CHECK(!scheme_type::verify_eval(beacon_pubkey, acc2, acc3_tampered));
+    acc3_tampered = acc3;
+    acc3_tampered.beta_g2 = acc3_tampered.beta_g2.doubled();
+    BOOST_CHECK(!scheme_type::verify_eval(beacon_pubkey, acc2, acc3_tampered));
+
     auto result = scheme_type::result_type::from_accumulator(acc3, 32);
 }
 
+BOOST_AUTO_TEST_CASE(powers_of_tau_stream_test) {
+    using curve_type = curves::bls12<381>;
+    using scheme_type = powers_of_tau<curve_type, 32>;
+
+    // chunks smaller than the sections and not dividing them
+    auto stream_acc = scheme_type::stream_accumulator_type(32, 5);
+
+    std::stringstream initial;
+    BOOST_CHECK(stream_acc.generate(initial));
+    auto acc1 = scheme_type::accumulator_type();
+    BOOST_CHECK(stream_acc.read(initial, acc1));
+    BOOST_CHECK(acc1.tau_powers_g1 == scheme_type::accumulator_type().tau_powers_g1);
+
+    // the stream is the marshalled accumulator
+    std::stringstream before;
+    BOOST_CHECK(stream_acc.write(before, acc1));
+    std::vector<std::uint8_t> blob = scheme_type::serialize_accumulator(acc1);
+    BOOST_CHECK(before.str() == std::string(blob.begin(), blob.end()));
+    BOOST_CHECK(initial.str() == before.str());
+
+    // so the streamed transcript is the one of the in-memory ceremony
+    std::stringstream after;
+    auto sk = scheme_type::generate_private_key();
+    std::vector<std::uint8_t> transcript = stream_acc.transform(before, after, sk);
+    BOOST_CHECK(!transcript.empty());
+    BOOST_CHECK(transcript == scheme_type::compute_transcript(acc1));
+
+    auto acc2 = acc1;
+    acc2.transform(sk);
+    auto acc3 = scheme_type::accumulator_type();
+    BOOST_CHECK(stream_acc.read(after, acc3));
+    BOOST_CHECK(acc2.tau_powers_g1 == acc3.tau_powers_g1);
+    BOOST_CHECK(acc2.tau_powers_g2 == acc3.tau_powers_g2);
+    BOOST_CHECK(acc2.alpha_tau_powers_g1 == acc3.alpha_tau_powers_g1);
+    BOOST_CHECK(acc2.beta_tau_powers_g1 == acc3.beta_tau_powers_g1);
+    BOOST_CHECK(acc2.beta_g2 == acc3.beta_g2);
+
+    auto pubkey = scheme_type::proof_eval(sk, transcript);
+    BOOST_CHECK(scheme_type::verify_eval(pubkey, acc1, acc3, transcript));
+
+    // a second contribution continues from the streamed result
+    std::stringstream before2(after.str());
+    std::stringstream after2;
+    auto sk2 = scheme_type::generate_private_key();
+    std::vector<std::uint8_t> transcript2 = stream_acc.transform(before2, after2, sk2);
+    BOOST_CHECK(transcript2 == scheme_type::compute_transcript(acc3));
+
+    // a truncated accumulator is rejected
+    std::stringstream truncated(before.str().substr(0, before.str().size() / 2));
+    std::stringstream ignored;
+    BOOST_CHECK(stream_acc.transform(truncated, ignored, sk).empty());
+}
+
 BOOST_AUTO_TEST_CASE(keypair_generation_basic_test) {
     using curve_type = curves::bls12<381>;
     using scheme_type = powers_of_tau<curve_type, 32>;
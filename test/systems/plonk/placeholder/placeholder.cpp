@@ -28,6 +28,8 @@
 
 #define BOOST_TEST_MODULE placeholder_test
 
+#include <map>
+#include <sstream>
 #include <string>
 #include <random>
 
@@ -50,12 +52,17 @@
 #include <nil/crypto3/hash/keccak.hpp>
 
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/prover.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/batch_prover.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/verifier.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/verification_key.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/permutation_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/lookup_argument.hpp>
 // #include <nil/crypto3/zk/snark/systems/plonk/placeholder/gates_argument.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/grand_product.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/lookup_permutation.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/compiled_gates.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/gate.hpp>
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
@@ -190,6 +197,68 @@ BOOST_AUTO_TEST_CASE(placeholder_split_polynomial_test) {
     BOOST_CHECK(f_at_y == f_splitted_at_y);
 }
 
+BOOST_AUTO_TEST_CASE(placeholder_grand_product_test) {
+
+    std::size_t size = 1000;
+    std::vector<typename FieldType::value_type> ratios(size);
+    for (std::size_t i = 0; i < size; i++) {
+        ratios[i] = algebra::random_element<FieldType>();
+    }
+
+    std::vector<typename FieldType::value_type> inversed = ratios;
+    zk::snark::detail::batch_inversion<FieldType>(inversed);
+    for (std::size_t i = 0; i < size; i++) {
+        BOOST_CHECK(ratios[i] * inversed[i] == FieldType::value_type::one());
+    }
+
+    std::vector<typename FieldType::value_type> product = zk::snark::detail::grand_product<FieldType>(ratios);
+    BOOST_CHECK(product.size() == size + 1);
+    BOOST_CHECK(product[0] == FieldType::value_type::one());
+    for (std::size_t i = 0; i < size; i++) {
+        BOOST_CHECK(product[i + 1] == product[i] * ratios[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(placeholder_lookup_permutation_test) {
+
+    std::size_t size = 256;
+    std::vector<typename FieldType::value_type> value(size);
+    for (std::size_t i = 0; i < size; i++) {
+        value[i] = algebra::random_element<FieldType>();
+    }
+    // Inputs repeat a part of the table, so that the runs of the sorted inputs have different lengths
+    std::vector<typename FieldType::value_type> input(size);
+    for (std::size_t i = 0; i < size; i++) {
+        input[i] = value[(i * i) % (size / 4)];
+    }
+
+    std::vector<typename FieldType::value_type> perm_input;
+    std::vector<typename FieldType::value_type> perm_value;
+    BOOST_CHECK(zk::snark::detail::lookup_permutation(input, value, perm_input, perm_value));
+
+    BOOST_CHECK(std::is_sorted(perm_input.begin(), perm_input.end()));
+    BOOST_CHECK(perm_input[0] == perm_value[0]);
+    for (std::size_t i = 1; i < size; i++) {
+        BOOST_CHECK(perm_input[i] == perm_input[i - 1] || perm_input[i] == perm_value[i]);
+    }
+
+    std::vector<typename FieldType::value_type> sorted_input = input;
+    std::vector<typename FieldType::value_type> sorted_value = value;
+    std::vector<typename FieldType::value_type> sorted_perm_value = perm_value;
+    std::sort(sorted_input.begin(), sorted_input.end());
+    std::sort(sorted_value.begin(), sorted_value.end());
+    std::sort(sorted_perm_value.begin(), sorted_perm_value.end());
+    BOOST_CHECK(sorted_input == perm_input);
+    BOOST_CHECK(sorted_value == sorted_perm_value);
+
+    // An input outside of the table still yields a permutation of the table
+    input[size / 2] = algebra::random_element<FieldType>();
+    BOOST_CHECK(!zk::snark::detail::lookup_permutation(input, value, perm_input, perm_value));
+    sorted_perm_value = perm_value;
+    std::sort(sorted_perm_value.begin(), sorted_perm_value.end());
+    BOOST_CHECK(sorted_value == sorted_perm_value);
+}
+
 BOOST_AUTO_TEST_CASE(placeholder_permutation_polynomials_test) {
 
     circuit_description<FieldType, circuit_2_params, table_rows_log, permutation_size> circuit =
@@ -268,6 +337,116 @@ BOOST_AUTO_TEST_CASE(placeholder_permutation_polynomials_test) {
     BOOST_CHECK_MESSAGE(id_res == sigma_res, "Complex check");
 }
 
+// Copy-constraint cycles kept in maps keyed by (column, row), as the preprocessor built them before it moved to flat
+// arrays. It is the reference for the permutation polynomials.
+struct map_cycle_representation {
+    typedef std::pair<std::size_t, std::size_t> key_type;
+
+    std::map<key_type, key_type> mapping;
+    std::map<key_type, key_type> aux;
+    std::map<key_type, std::size_t> sizes;
+
+    map_cycle_representation(std::size_t columns, std::size_t rows) {
+        for (std::size_t i = 0; i < columns; i++) {
+            for (std::size_t j = 0; j < rows; j++) {
+                key_type key(i, j);
+                mapping[key] = key;
+                aux[key] = key;
+                sizes[key] = 1;
+            }
+        }
+    }
+
+    void apply_copy_constraint(key_type x, key_type y) {
+        if (aux[x] != aux[y]) {
+            if (sizes[aux[x]] < sizes[aux[y]]) {
+                std::swap(x, y);
+            }
+
+            sizes[aux[x]] = sizes[aux[x]] + sizes[aux[y]];
+
+            key_type z = aux[y];
+            key_type exit_condition = aux[y];
+            do {
+                aux[z] = aux[x];
+                z = mapping[z];
+            } while (z != exit_condition);
+
+            std::swap(mapping[x], mapping[y]);
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(placeholder_permutation_polynomials_reference_test) {
+
+    circuit_description<FieldType, circuit_2_params, table_rows_log, permutation_size> circuit =
+        circuit_test_2<FieldType>();
+
+    using policy_type = zk::snark::detail::placeholder_policy<FieldType, circuit_2_params>;
+    using variable_type = plonk_variable<FieldType>;
+
+    typename fri_type::params_type fri_params = create_fri_params<fri_type, FieldType>(table_rows_log);
+
+    plonk_table_description<FieldType, typename circuit_2_params::arithmetization_params> desc;
+
+    desc.rows_amount = table_rows;
+    desc.usable_rows_amount = usable_rows;
+
+    const variable_type::column_type witness = variable_type::column_type::witness;
+    const variable_type::column_type public_input = variable_type::column_type::public_input;
+
+    // Cycles spanning several columns, one of them merged into the cycle of the circuit through the public input
+    std::vector<plonk_copy_constraint<FieldType>> copy_constraints = circuit.copy_constraints;
+    copy_constraints.emplace_back(variable_type(0, 1, false, witness), variable_type(0, 2, false, public_input));
+    copy_constraints.emplace_back(variable_type(0, 2, false, public_input), variable_type(2, 13, false, witness));
+    copy_constraints.emplace_back(variable_type(0, 1, false, witness), variable_type(2, 13, false, witness));
+    copy_constraints.emplace_back(variable_type(0, 14, false, witness), variable_type(1, 0, false, witness));
+    copy_constraints.emplace_back(variable_type(1, 0, false, witness), variable_type(2, 15, false, witness));
+    copy_constraints.emplace_back(variable_type(2, 15, false, witness), variable_type(0, 0, false, public_input));
+    copy_constraints.emplace_back(variable_type(0, 15, false, witness), variable_type(0, 1, false, witness));
+
+    typename policy_type::constraint_system_type constraint_system(circuit.gates, copy_constraints,
+                                                                   circuit.lookup_gates);
+    typename policy_type::variable_assignment_type assignments = circuit.table;
+
+    typename placeholder_public_preprocessor<FieldType, circuit_2_params>::preprocessed_data_type
+        preprocessed_public_data = placeholder_public_preprocessor<FieldType, circuit_2_params>::process(
+            constraint_system, assignments.public_table(), desc, fri_params, permutation_size);
+
+    map_cycle_representation reference(permutation_size, table_rows);
+    for (const plonk_copy_constraint<FieldType> &constraint : copy_constraints) {
+        reference.apply_copy_constraint(
+            {desc.global_index(constraint.first), static_cast<std::size_t>(constraint.first.rotation)},
+            {desc.global_index(constraint.second), static_cast<std::size_t>(constraint.second.rotation)});
+    }
+
+    std::shared_ptr<math::evaluation_domain<FieldType>> domain = preprocessed_public_data.common_data.basic_domain;
+    const typename FieldType::value_type omega = domain->get_domain_element(1);
+    BOOST_REQUIRE_EQUAL(preprocessed_public_data.permutation_polynomials.size(), permutation_size);
+    for (std::size_t i = 0; i < permutation_size; i++) {
+        for (std::size_t j = 0; j < table_rows; j++) {
+            const map_cycle_representation::key_type image = reference.mapping[{i, j}];
+            BOOST_CHECK(preprocessed_public_data.permutation_polynomials[i][j] ==
+                        circuit_2_params::delta.pow(image.first) * omega.pow(image.second));
+        }
+    }
+
+    // Copy constraints naming a row or a column outside of the table are rejected
+    for (const plonk_copy_constraint<FieldType> &outside :
+         {plonk_copy_constraint<FieldType>(variable_type(0, table_rows, false, witness),
+                                           variable_type(1, 0, false, witness)),
+          plonk_copy_constraint<FieldType>(variable_type(0, -1, false, witness), variable_type(1, 0, false, witness)),
+          plonk_copy_constraint<FieldType>(variable_type(0, 0, false, witness),
+                                           variable_type(1, 0, false, public_input))}) {
+        typename policy_type::constraint_system_type outside_constraint_system(
+            circuit.gates, std::vector<plonk_copy_constraint<FieldType>> {outside}, circuit.lookup_gates);
+        BOOST_CHECK_THROW(placeholder_public_preprocessor<FieldType, circuit_2_params>::process(
+                              outside_constraint_system, assignments.public_table(), desc, fri_params,
+                              permutation_size),
+                          std::invalid_argument);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(placeholder_permutation_argument_test) {
 
     circuit_description<FieldType, circuit_2_params, table_rows_log, permutation_size> circuit =
@@ -396,14 +575,16 @@ BOOST_AUTO_TEST_CASE(placeholder_lookup_argument_test) {
 
     // Challenge phase
     typename FieldType::value_type y = algebra::random_element<FieldType>();
-    typename policy_type::evaluation_map columns_at_y;
+    typename policy_type::evaluation_map columns_at_y(std::make_shared<const typename policy_type::evaluation_layout>(
+        preprocessed_public_data.common_data.columns_rotations, placeholder_test_params_lookups::witness_columns,
+        placeholder_test_params_lookups::public_input_columns, placeholder_test_params_lookups::constant_columns));
     for (std::size_t i = 0; i < placeholder_test_params::witness_columns; i++) {
 
         std::size_t i_global_index = i;
 
         for (int rotation : preprocessed_public_data.common_data.columns_rotations[i_global_index]) {
-            auto key = std::make_tuple(i, rotation, plonk_variable<FieldType>::column_type::witness);
-            columns_at_y[key] = polynomial_table.witness(i).evaluate(y * circuit.omega.pow(rotation));
+            plonk_variable<FieldType> var(i, rotation, true, plonk_variable<FieldType>::column_type::witness);
+            columns_at_y[var] = polynomial_table.witness(i).evaluate(y * circuit.omega.pow(rotation));
         }
     }
     for (std::size_t i = 0; i < 0 + placeholder_test_params_lookups::constant_columns; i++) {
@@ -412,9 +593,9 @@ BOOST_AUTO_TEST_CASE(placeholder_lookup_argument_test) {
                                      placeholder_test_params_lookups::public_input_columns + i;
 
         for (int rotation : preprocessed_public_data.common_data.columns_rotations[i_global_index]) {
-            auto key = std::make_tuple(i, rotation, plonk_variable<FieldType>::column_type::constant);
+            plonk_variable<FieldType> var(i, rotation, true, plonk_variable<FieldType>::column_type::constant);
 
-            columns_at_y[key] = polynomial_table.constant(i).evaluate(y * circuit.omega.pow(rotation));
+            columns_at_y[var] = polynomial_table.constant(i).evaluate(y * circuit.omega.pow(rotation));
         }
     }
     for (std::size_t i = 0; i < placeholder_test_params_lookups::selector_columns; i++) {
@@ -424,9 +605,9 @@ BOOST_AUTO_TEST_CASE(placeholder_lookup_argument_test) {
                                      placeholder_test_params_lookups::public_input_columns + i;
 
         for (int rotation : preprocessed_public_data.common_data.columns_rotations[i_global_index]) {
-            auto key = std::make_tuple(i, rotation, plonk_variable<FieldType>::column_type::selector);
+            plonk_variable<FieldType> var(i, rotation, true, plonk_variable<FieldType>::column_type::selector);
 
-            columns_at_y[key] = polynomial_table.selector(i).evaluate(y * circuit.omega.pow(rotation));
+            columns_at_y[var] = polynomial_table.selector(i).evaluate(y * circuit.omega.pow(rotation));
         }
     }
 
@@ -458,6 +639,142 @@ BOOST_AUTO_TEST_CASE(placeholder_lookup_argument_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(placeholder_lookup_argument_missing_input_test) {
+
+    circuit_description<FieldType, circuit_3_params, table_rows_log, 3> circuit = circuit_test_3<FieldType>();
+
+    using policy_type = zk::snark::detail::placeholder_policy<FieldType, circuit_3_params>;
+
+    typedef commitments::lpc<FieldType, circuit_3_params::batched_commitment_params_type, 1, true> lpc_type;
+
+    typename fri_type::params_type fri_params = create_fri_params<fri_type, FieldType>(table_rows_log);
+
+    plonk_table_description<FieldType, typename circuit_3_params::arithmetization_params> desc;
+
+    desc.rows_amount = table_rows;
+    desc.usable_rows_amount = usable_rows;
+
+    plonk_variable<FieldType> w0(0, 0, true, plonk_variable<FieldType>::column_type::witness);
+    plonk_variable<FieldType> w1(1, 0, true, plonk_variable<FieldType>::column_type::witness);
+    plonk_variable<FieldType> w2(2, 0, true, plonk_variable<FieldType>::column_type::witness);
+    plonk_variable<FieldType> c0(0, 0, true, plonk_variable<FieldType>::column_type::constant);
+    plonk_variable<FieldType> c1(1, 0, true, plonk_variable<FieldType>::column_type::constant);
+    plonk_variable<FieldType> c2(2, 0, true, plonk_variable<FieldType>::column_type::constant);
+
+    // The selected row looks up (w0, w1, w2) = (1, 0, 1), while the selected row of the table is (0, 0, 0)
+    plonk_lookup_constraint<FieldType> missing_constraint;
+    missing_constraint.lookup_input = {math::non_linear_term<plonk_variable<FieldType>>(w0),
+                                       math::non_linear_term<plonk_variable<FieldType>>(w1),
+                                       math::non_linear_term<plonk_variable<FieldType>>(w2)};
+    missing_constraint.lookup_value = {c0, c1, c2};
+
+    // w1 = 0 is in the table
+    plonk_lookup_constraint<FieldType> present_constraint;
+    present_constraint.lookup_input = {math::non_linear_term<plonk_variable<FieldType>>(w1)};
+    present_constraint.lookup_value = {c0};
+
+    typename policy_type::variable_assignment_type assignments = circuit.table;
+
+    auto prove = [&](const plonk_lookup_constraint<FieldType> &constraint) {
+        std::vector<plonk_gate<FieldType, plonk_lookup_constraint<FieldType>>> lookup_gates = {
+            plonk_gate<FieldType, plonk_lookup_constraint<FieldType>>(0, constraint)};
+        typename policy_type::constraint_system_type constraint_system(circuit.gates, circuit.copy_constraints,
+                                                                       lookup_gates);
+
+        typename placeholder_public_preprocessor<FieldType, circuit_3_params>::preprocessed_data_type
+            preprocessed_public_data = placeholder_public_preprocessor<FieldType, circuit_3_params>::process(
+                constraint_system, assignments.public_table(), desc, fri_params, 0);
+
+        std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        transcript::fiat_shamir_heuristic_sequential<placeholder_test_params_lookups::transcript_hash_type>
+            prover_transcript(init_blob);
+
+        return placeholder_lookup_argument<FieldType, lpc_type, circuit_3_params>::prove_eval(
+            constraint_system, preprocessed_public_data, assignments, fri_params, prover_transcript);
+    };
+
+    BOOST_CHECK_NO_THROW(prove(present_constraint));
+    BOOST_CHECK_THROW(prove(missing_constraint), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(placeholder_compiled_gates_test) {
+    typedef plonk_arithmetization_params<3, 1, 2, 2> arithmetization_params;
+    typedef typename FieldType::value_type value_type;
+    typedef math::polynomial_dfs<value_type> polynomial_dfs_type;
+    typedef plonk_variable<FieldType> variable_type;
+    typedef math::non_linear_term<variable_type> term_type;
+
+    std::shared_ptr<math::evaluation_domain<FieldType>> domain = math::make_evaluation_domain<FieldType>(table_rows);
+
+    auto random_column = []() {
+        std::vector<value_type> values(table_rows);
+        for (std::size_t i = 0; i < table_rows; i++) {
+            values[i] = algebra::random_element<FieldType>();
+        }
+        return polynomial_dfs_type(table_rows - 1, values.begin(), values.end());
+    };
+    std::array<polynomial_dfs_type, 3> witnesses = {random_column(), random_column(), random_column()};
+    std::array<polynomial_dfs_type, 1> public_inputs = {random_column()};
+    std::array<polynomial_dfs_type, 2> constants = {random_column(), random_column()};
+    std::array<polynomial_dfs_type, 2> selectors = {random_column(), random_column()};
+    plonk_polynomial_dfs_table<FieldType, arithmetization_params> table(
+        plonk_private_polynomial_dfs_table<FieldType, arithmetization_params>(witnesses),
+        plonk_public_polynomial_dfs_table<FieldType, arithmetization_params>(public_inputs, constants, selectors));
+
+    const variable_type w0(0, 0, true, variable_type::column_type::witness);
+    const variable_type w0_prev(0, -1, true, variable_type::column_type::witness);
+    const variable_type w1(1, 0, true, variable_type::column_type::witness);
+    const variable_type w2_next(2, 1, true, variable_type::column_type::witness);
+    const variable_type w2(2, 0, true, variable_type::column_type::witness);
+    const variable_type p0(0, 0, true, variable_type::column_type::public_input);
+    const variable_type c0(0, 0, true, variable_type::column_type::constant);
+    const variable_type c1_next(1, 1, true, variable_type::column_type::constant);
+    const variable_type s0(0, 0, true, variable_type::column_type::selector);
+
+    auto coeff = []() { return algebra::random_element<FieldType>(); };
+
+    // w0 * w1 is shared by the constraints of both gates, the selector of the first gate is also an operand
+    std::vector<plonk_gate<FieldType, plonk_constraint<FieldType>>> gates = {
+        plonk_gate<FieldType, plonk_constraint<FieldType>>(
+            0, std::vector<plonk_constraint<FieldType>> {
+                   plonk_constraint<FieldType>(std::vector<term_type> {
+                       term_type({w0, w1}, coeff()), term_type({w2_next}, coeff()), term_type({c0}, coeff())}),
+                   plonk_constraint<FieldType>(std::vector<term_type> {term_type({w0, w1, w0_prev}, coeff()),
+                                                                       term_type({p0}, coeff()), term_type(coeff())})}),
+        plonk_gate<FieldType, plonk_constraint<FieldType>>(
+            1, std::vector<plonk_constraint<FieldType>> {
+                   plonk_constraint<FieldType>(
+                       std::vector<term_type> {term_type({w0, w1}, coeff()), term_type({c1_next, w2}, coeff())}),
+                   plonk_constraint<FieldType>(
+                       std::vector<term_type> {term_type({s0, w1}, coeff()), term_type({w1, w1}, coeff())})})};
+
+    const value_type theta = algebra::random_element<FieldType>();
+
+    zk::snark::detail::compiled_gates<FieldType> compiled(gates);
+    BOOST_CHECK_EQUAL(compiled.constraints_number(), 4);
+    polynomial_dfs_type result = compiled.evaluate(table, table_rows, theta);
+
+    polynomial_dfs_type expected(0, table_rows, value_type::zero());
+    value_type theta_acc = value_type::one();
+    for (const auto &gate : gates) {
+        polynomial_dfs_type gate_result(0, table_rows, value_type::zero());
+        for (const auto &constraint : gate.constraints) {
+            gate_result = gate_result + constraint.evaluate(table, domain) * theta_acc;
+            theta_acc *= theta;
+        }
+        expected = expected + gate_result * table.selector(gate.selector_index);
+    }
+
+    for (std::size_t i = 0; i < 3; i++) {
+        const value_type y = algebra::random_element<FieldType>();
+        BOOST_CHECK(result.evaluate(y) == expected.evaluate(y));
+    }
+    for (std::size_t i = 0; i < table_rows; i++) {
+        const value_type x = domain->get_domain_element(i);
+        BOOST_CHECK(result.evaluate(x) == expected.evaluate(x));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(placeholder_gate_argument_test) {
 
     circuit_description<FieldType, circuit_2_params, table_rows_log, permutation_size> circuit =
@@ -500,7 +817,7 @@ BOOST_AUTO_TEST_CASE(placeholder_gate_argument_test) {
     transcript::fiat_shamir_heuristic_sequential<placeholder_test_params::transcript_hash_type> verifier_transcript(
         init_blob);
 
-    std::array<math::polynomial<typename FieldType::value_type>, 1> prover_res =
+    std::array<math::polynomial_dfs<typename FieldType::value_type>, 1> prover_res =
         placeholder_gates_argument<FieldType, circuit_2_params>::prove_eval(
             constraint_system, polynomial_table, preprocessed_public_data.common_data.basic_domain, prover_transcript);
 
@@ -508,14 +825,16 @@ BOOST_AUTO_TEST_CASE(placeholder_gate_argument_test) {
     typename FieldType::value_type y = algebra::random_element<FieldType>();
     typename FieldType::value_type omega = preprocessed_public_data.common_data.basic_domain->get_domain_element(1);
 
-    typename policy_type::evaluation_map columns_at_y;
+    typename policy_type::evaluation_map columns_at_y(std::make_shared<const typename policy_type::evaluation_layout>(
+        preprocessed_public_data.common_data.columns_rotations, placeholder_test_params::witness_columns,
+        placeholder_test_params::public_input_columns, placeholder_test_params::constant_columns));
     for (std::size_t i = 0; i < placeholder_test_params::witness_columns; i++) {
 
         std::size_t i_global_index = i;
 
         for (int rotation : preprocessed_public_data.common_data.columns_rotations[i_global_index]) {
-            auto key = std::make_tuple(i, rotation, plonk_variable<FieldType>::column_type::witness);
-            columns_at_y[key] = polynomial_table.witness(i).evaluate(y * omega.pow(rotation));
+            plonk_variable<FieldType> var(i, rotation, true, plonk_variable<FieldType>::column_type::witness);
+            columns_at_y[var] = polynomial_table.witness(i).evaluate(y * omega.pow(rotation));
         }
     }
     for (std::size_t i = 0; i < 0 + placeholder_test_params::public_input_columns; i++) {
@@ -524,9 +843,9 @@ BOOST_AUTO_TEST_CASE(placeholder_gate_argument_test) {
 
         for (int rotation : preprocessed_public_data.common_data.columns_rotations[i_global_index]) {
 
-            auto key = std::make_tuple(i, rotation, plonk_variable<FieldType>::column_type::public_input);
+            plonk_variable<FieldType> var(i, rotation, true, plonk_variable<FieldType>::column_type::public_input);
 
-            columns_at_y[key] = polynomial_table.public_input(i).evaluate(y * omega.pow(rotation));
+            columns_at_y[var] = polynomial_table.public_input(i).evaluate(y * omega.pow(rotation));
         }
     }
     for (std::size_t i = 0; i < 0 + placeholder_test_params::constant_columns; i++) {
@@ -535,9 +854,9 @@ BOOST_AUTO_TEST_CASE(placeholder_gate_argument_test) {
             placeholder_test_params::witness_columns + placeholder_test_params::public_input_columns + i;
 
         for (int rotation : preprocessed_public_data.common_data.columns_rotations[i_global_index]) {
-            auto key = std::make_tuple(i, rotation, plonk_variable<FieldType>::column_type::constant);
+            plonk_variable<FieldType> var(i, rotation, true, plonk_variable<FieldType>::column_type::constant);
 
-            columns_at_y[key] = polynomial_table.constant(i).evaluate(y * omega.pow(rotation));
+            columns_at_y[var] = polynomial_table.constant(i).evaluate(y * omega.pow(rotation));
         }
     }
     for (std::size_t i = 0; i < placeholder_test_params::selector_columns; i++) {
@@ -547,9 +866,9 @@ BOOST_AUTO_TEST_CASE(placeholder_gate_argument_test) {
                                      placeholder_test_params::public_input_columns + i;
 
         for (int rotation : preprocessed_public_data.common_data.columns_rotations[i_global_index]) {
-            auto key = std::make_tuple(i, rotation, plonk_variable<FieldType>::column_type::selector);
+            plonk_variable<FieldType> var(i, rotation, true, plonk_variable<FieldType>::column_type::selector);
 
-            columns_at_y[key] = polynomial_table.selector(i).evaluate(y * omega.pow(rotation));
+            columns_at_y[var] = polynomial_table.selector(i).evaluate(y * omega.pow(rotation));
         }
     }
 
@@ -599,12 +918,76 @@ BOOST_AUTO_TEST_CASE(placeholder_prover_basic_test) {
         placeholder_private_preprocessor<FieldType, circuit_2_params>::process(constraint_system,
                                                                                assignments.private_table(), desc, fri_params);
 
+    placeholder_profiler prover_profiler;
     auto proof = placeholder_prover<FieldType, circuit_2_params>::process(
-        preprocessed_public_data, preprocessed_private_data, desc, constraint_system, assignments, fri_params);
+        preprocessed_public_data, preprocessed_private_data, desc, constraint_system, assignments, fri_params,
+        &prover_profiler);
 
-    bool verifier_res = placeholder_verifier<FieldType, circuit_2_params>::process(preprocessed_public_data, proof,
-                                                                                   constraint_system, fri_params);
+    placeholder_profiler verifier_profiler;
+    bool verifier_res = placeholder_verifier<FieldType, circuit_2_params>::process(
+        preprocessed_public_data, proof, constraint_system, fri_params, &verifier_profiler);
     BOOST_CHECK(verifier_res);
+
+    BOOST_CHECK(!prover_profiler.stages().empty());
+    BOOST_CHECK(prover_profiler.stages().back().name == "placeholder_prover.fixed_values_proof_eval");
+    BOOST_CHECK(verifier_profiler.stages().back().name == "placeholder_verifier.final_check");
+
+    placeholder_profiler named_profiler;
+    placeholder_profiler::timer timer(&named_profiler, "a\"b");
+    timer.checkpoint("c\\d\n");
+    std::ostringstream json;
+    named_profiler.write_json(json);
+    BOOST_CHECK(json.str().find("\"name\":\"a\\\"b.c\\\\d\\u000a\"") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(placeholder_verification_key_test) {
+
+    circuit_description<FieldType, circuit_2_params, table_rows_log, permutation_size> circuit =
+        circuit_test_2<FieldType>();
+
+    using policy_type = zk::snark::detail::placeholder_policy<FieldType, circuit_2_params>;
+    using verification_key_type = placeholder_verification_key<FieldType, circuit_2_params>;
+
+    typename fri_type::params_type fri_params = create_fri_params<fri_type, FieldType>(table_rows_log);
+
+    plonk_table_description<FieldType, typename circuit_2_params::arithmetization_params> desc;
+
+    desc.rows_amount = table_rows;
+    desc.usable_rows_amount = usable_rows;
+
+    typename policy_type::constraint_system_type constraint_system(circuit.gates, circuit.copy_constraints,
+                                                                   circuit.lookup_gates);
+    typename policy_type::variable_assignment_type assignments = circuit.table;
+
+    typename placeholder_public_preprocessor<FieldType, circuit_2_params>::preprocessed_data_type
+        preprocessed_public_data = placeholder_public_preprocessor<FieldType, circuit_2_params>::process(
+            constraint_system, assignments.public_table(), desc, fri_params, permutation_size);
+
+    typename placeholder_private_preprocessor<FieldType, circuit_2_params>::preprocessed_data_type
+        preprocessed_private_data = placeholder_private_preprocessor<FieldType, circuit_2_params>::process(
+            constraint_system, assignments.private_table(), desc, fri_params);
+
+    const verification_key_type verification_key(preprocessed_public_data);
+
+    // The closed forms agree with the dfs polynomials of the preprocessor, also on the points of the domain
+    std::vector<typename FieldType::value_type> points = {algebra::random_element<FieldType>(),
+                                                          verification_key.omega.pow(usable_rows),
+                                                          verification_key.omega.pow(table_rows - 1)};
+    for (const auto &y : points) {
+        typename verification_key_type::evaluations_type expected =
+            verification_key_type::evaluate(preprocessed_public_data, y);
+        typename verification_key_type::evaluations_type actual = verification_key.evaluate(y);
+        BOOST_CHECK(expected.Z == actual.Z);
+        BOOST_CHECK(expected.lagrange_0 == actual.lagrange_0);
+        BOOST_CHECK(expected.q_last == actual.q_last);
+        BOOST_CHECK(expected.q_blind == actual.q_blind);
+    }
+
+    auto proof = placeholder_prover<FieldType, circuit_2_params>::process(
+        preprocessed_public_data, preprocessed_private_data, desc, constraint_system, assignments, fri_params);
+
+    BOOST_CHECK(placeholder_verifier<FieldType, circuit_2_params>::process(verification_key, proof,
+                                                                           constraint_system, fri_params));
 }
 
 BOOST_AUTO_TEST_CASE(placeholder_prover_lookup_test) {
@@ -648,4 +1031,40 @@ BOOST_AUTO_TEST_CASE(placeholder_prover_lookup_test) {
                                                                                    constraint_system, fri_params);
     BOOST_CHECK(verifier_res);
 }
+
+BOOST_AUTO_TEST_CASE(placeholder_batch_prover_basic_test) {
+    circuit_description<FieldType, circuit_2_params, table_rows_log, permutation_size> circuit =
+        circuit_test_2<FieldType>();
+
+    using policy_type = zk::snark::detail::placeholder_policy<FieldType, circuit_2_params>;
+
+    typename fri_type::params_type fri_params = create_fri_params<fri_type, FieldType>(table_rows_log);
+
+    plonk_table_description<FieldType, typename circuit_2_params::arithmetization_params> desc;
+
+    desc.rows_amount = table_rows;
+    desc.usable_rows_amount = usable_rows;
+
+    typename policy_type::constraint_system_type constraint_system(circuit.gates, circuit.copy_constraints,
+                                                                   circuit.lookup_gates);
+    std::vector<typename policy_type::variable_assignment_type> assignments(3, circuit.table);
+
+    std::vector<std::size_t> columns_with_copy_constraints = {0, 1, 2, 3};
+
+    typename placeholder_public_preprocessor<FieldType, circuit_2_params>::preprocessed_data_type
+        preprocessed_public_data =
+        placeholder_public_preprocessor<FieldType, circuit_2_params>::process(
+            constraint_system, circuit.table.public_table(), desc,
+            fri_params, columns_with_copy_constraints.size());
+
+    auto proofs = placeholder_batch_prover<FieldType, circuit_2_params>::process(
+        preprocessed_public_data, desc, constraint_system, assignments, fri_params);
+
+    BOOST_CHECK(proofs.size() == assignments.size());
+    for (const auto &proof : proofs) {
+        bool verifier_res = placeholder_verifier<FieldType, circuit_2_params>::process(
+            preprocessed_public_data, proof, constraint_system, fri_params);
+        BOOST_CHECK(verifier_res);
+    }
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,7 @@
 
 #define BOOST_TEST_MODULE plonk_constraint_test
 
+#include <stdexcept>
 #include <string>
 
 #include <boost/test/unit_test.hpp>
@@ -123,4 +124,119 @@ BOOST_AUTO_TEST_CASE(plonk_constraint_basic_test) {
         constraint9.evaluate(0, assignment));
 }
 
+BOOST_AUTO_TEST_CASE(plonk_column_view_test) {
+
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+
+    using var = zk::snark::plonk_variable<FieldType>;
+
+    using constraint_type = zk::snark::plonk_constraint<FieldType>;
+
+    using arithmetization_params = zk::snark::plonk_arithmetization_params<2, 1, 0, 1>;
+
+    constexpr static const std::size_t rows = 4;
+
+    std::array<zk::snark::plonk_column<FieldType>, arithmetization_params::witness_columns> witness_columns;
+    std::array<zk::snark::plonk_column<FieldType>, arithmetization_params::public_input_columns> public_columns;
+    std::array<zk::snark::plonk_column<FieldType>, arithmetization_params::constant_columns> constant_columns;
+    std::array<zk::snark::plonk_column<FieldType>, arithmetization_params::selector_columns> selector_columns;
+    for (auto &column : witness_columns) {
+        for (std::size_t i = 0; i < rows; i++) {
+            column.push_back(algebra::random_element<FieldType>());
+        }
+    }
+    public_columns[0].resize(rows, FieldType::value_type::zero());
+    public_columns[0][0] = algebra::random_element<FieldType>();
+    selector_columns[0].resize(rows, FieldType::value_type::one());
+    selector_columns[0][0] = FieldType::value_type::zero();
+
+    zk::snark::plonk_assignment_table<FieldType, arithmetization_params> assignment(
+        zk::snark::plonk_private_assignment_table<FieldType, arithmetization_params>(witness_columns),
+        zk::snark::plonk_public_assignment_table<FieldType, arithmetization_params>(public_columns, constant_columns,
+                                                                                    selector_columns));
+
+    // Views and references point into the table storage, copies of the table share it
+    const auto view = assignment.witness_view(1);
+    BOOST_CHECK_EQUAL(view.size(), rows);
+    BOOST_CHECK(view.data() == assignment.witness(1).data());
+    BOOST_CHECK(&assignment.private_table().witnesses()[1] == &assignment.witness(1));
+
+    const zk::snark::plonk_assignment_table<FieldType, arithmetization_params> copy = assignment;
+    BOOST_CHECK(copy.witness_view(1).data() == view.data());
+    BOOST_CHECK(&copy.selector(0) == &assignment.selector(0));
+    BOOST_CHECK(&assignment[arithmetization_params::witness_columns] == &assignment.public_input(0));
+
+    // Rotations wrap around the column
+    for (std::size_t i = 0; i < rows; i++) {
+        BOOST_CHECK(view(i, 0) == witness_columns[1][i]);
+        BOOST_CHECK(view(i, 1) == witness_columns[1][(i + 1) % rows]);
+        BOOST_CHECK(view(i, -1) == witness_columns[1][(i + rows - 1) % rows]);
+    }
+
+    constraint_type constraint = var(0, 0) * var(1, -1) - var(1, 1);
+    for (std::size_t i = 1; i < rows - 1; i++) {
+        BOOST_CHECK((witness_columns[0][i] * witness_columns[1][i - 1] - witness_columns[1][i + 1]) ==
+                    constraint.evaluate(i, assignment));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(plonk_evaluation_map_test) {
+
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+
+    using var = zk::snark::plonk_variable<FieldType>;
+
+    using constraint_type = zk::snark::plonk_constraint<FieldType>;
+    using layout_type = zk::snark::detail::plonk_evaluation_layout<var>;
+    using evaluation_map_type = zk::snark::detail::plonk_evaluation_map<var>;
+
+    // Two witnesses, one public input, no constant, one selector
+    std::array<std::vector<int>, 4> columns_rotations = {
+        std::vector<int> {0, 1, -1}, std::vector<int> {0, 2}, std::vector<int> {0}, std::vector<int> {0}};
+
+    auto layout = std::make_shared<const layout_type>(columns_rotations, 2, 1, 0);
+    BOOST_CHECK_EQUAL(layout->size(), 7);
+    BOOST_CHECK_EQUAL(layout->columns(), 4);
+
+    // Slots follow the columns rotations column by column
+    std::size_t slot = 0;
+    for (std::size_t i = 0; i < columns_rotations.size(); i++) {
+        for (int rotation : columns_rotations[i]) {
+            BOOST_CHECK_EQUAL(layout->slot(i, rotation), slot++);
+        }
+    }
+    BOOST_CHECK_EQUAL(layout->slot(var(1, 2)), 4);
+    BOOST_CHECK_EQUAL(layout->slot(var(0, 0, true, var::column_type::public_input)), 5);
+    BOOST_CHECK_EQUAL(layout->slot(var(0, 0, true, var::column_type::selector)), 6);
+
+    // Rotations and columns which are not opened
+    BOOST_CHECK_EQUAL(layout->slot(var(1, 1)), layout_type::npos);
+    BOOST_CHECK_EQUAL(layout->slot(var(0, 2)), layout_type::npos);
+    BOOST_CHECK_EQUAL(layout->slot(var(0, -2)), layout_type::npos);
+    BOOST_CHECK_EQUAL(layout->slot(var(2, 0)), layout_type::npos);
+    BOOST_CHECK_EQUAL(layout->slot(var(0, 0, true, var::column_type::constant)), layout_type::npos);
+    BOOST_CHECK_EQUAL(layout->slot(4, 0), layout_type::npos);
+
+    evaluation_map_type evaluations(layout);
+    for (auto &value : evaluations.values()) {
+        value = algebra::random_element<FieldType>();
+    }
+
+    constraint_type constraint =
+        var(0, 1) * var(1, 2) - var(0, -1) + var(0, 0, true, var::column_type::public_input);
+    BOOST_CHECK((evaluations.values()[1] * evaluations.values()[4] - evaluations.values()[2] +
+                 evaluations.values()[5]) == constraint.evaluate(evaluations));
+
+    evaluations[var(0, 0, true, var::column_type::selector)] = FieldType::value_type::one();
+    BOOST_CHECK(evaluations.values()[6] == FieldType::value_type::one());
+
+    // Variables which are not opened are rejected
+    const evaluation_map_type &const_evaluations = evaluations;
+    BOOST_CHECK_THROW(evaluations[var(1, 1)], std::out_of_range);
+    BOOST_CHECK_THROW(const_evaluations[var(0, 0, true, var::column_type::constant)], std::out_of_range);
+    BOOST_CHECK_THROW(constraint_type(var(2, 0)).evaluate(evaluations), std::out_of_range);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -32,6 +32,12 @@
 
 #include <cassert>
 #include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/fields/mnt4/base_field.hpp>
@@ -44,6 +50,11 @@
 #include <nil/crypto3/algebra/pairing/mnt6.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/mapped_proving_key.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/prepared_proving_key.hpp>
+
 #include "../r1cs_examples.hpp"
 #include "run_r1cs_gg_ppzksnark.hpp"
 
@@ -58,10 +69,235 @@ void run_r1cs_gg_ppzksnark_basic_test(std::size_t num_constraints, std::size_t i
     BOOST_CHECK(bit);
 }
 
+template<typename CurveType>
+void run_r1cs_gg_ppzksnark_batch_test(std::size_t num_constraints, std::size_t input_size, std::size_t batch_size) {
+    typedef r1cs_gg_ppzksnark<CurveType> proof_system_type;
+    typedef r1cs_gg_ppzksnark_batch_verifier<CurveType> batch_verifier_type;
+
+    r1cs_example<typename CurveType::scalar_field_type> example =
+        generate_r1cs_example_with_binary_input<typename CurveType::scalar_field_type>(num_constraints, input_size);
+    r1cs_example<typename CurveType::scalar_field_type> other_example =
+        generate_r1cs_example_with_binary_input<typename CurveType::scalar_field_type>(num_constraints, input_size);
+
+    typename proof_system_type::keypair_type keypair =
+        nil::crypto3::zk::generate<proof_system_type>(example.constraint_system);
+    typename proof_system_type::keypair_type other_keypair =
+        nil::crypto3::zk::generate<proof_system_type>(other_example.constraint_system);
+    typename proof_system_type::processed_verification_key_type pvk =
+        r1cs_gg_ppzksnark_process_verification_key<CurveType>::process(keypair.second);
+    typename proof_system_type::processed_verification_key_type other_pvk =
+        r1cs_gg_ppzksnark_process_verification_key<CurveType>::process(other_keypair.second);
+
+    std::vector<typename proof_system_type::primary_input_type> primary_inputs(batch_size, example.primary_input);
+    std::vector<typename proof_system_type::proof_type> proofs;
+    for (std::size_t i = 0; i < batch_size; i++) {
+        proofs.emplace_back(nil::crypto3::zk::prove<proof_system_type>(keypair.first, example.primary_input,
+                                                                       example.auxiliary_input));
+    }
+
+    BOOST_CHECK(batch_verifier_type::process(keypair.second, primary_inputs, proofs));
+    BOOST_CHECK(batch_verifier_type::process(pvk, primary_inputs, proofs));
+
+    // proofs of two circuits in one batch
+    std::vector<typename proof_system_type::processed_verification_key_type> pvks(batch_size, pvk);
+    pvks.back() = other_pvk;
+    primary_inputs.back() = other_example.primary_input;
+    proofs.back() = nil::crypto3::zk::prove<proof_system_type>(other_keypair.first, other_example.primary_input,
+                                                               other_example.auxiliary_input);
+    BOOST_CHECK(batch_verifier_type::process(pvks, primary_inputs, proofs));
+    BOOST_CHECK(!batch_verifier_type::process(pvk, primary_inputs, proofs));
+
+    // one proof paired with the A of another invalidates the batch
+    const typename proof_system_type::proof_type first_proof = proofs.front();
+    proofs.front().g_A = proofs[1].g_A;
+    BOOST_CHECK(!batch_verifier_type::process(pvks, primary_inputs, proofs));
+    proofs.front() = first_proof;
+
+    // one wrong primary input invalidates the batch
+    primary_inputs.front()[0] = primary_inputs.front()[0] + CurveType::scalar_field_type::value_type::one();
+    BOOST_CHECK(!batch_verifier_type::process(pvks, primary_inputs, proofs));
+}
+
+template<typename CurveType>
+void run_r1cs_gg_ppzksnark_mapped_proving_key_test(std::size_t num_constraints, std::size_t input_size) {
+    typedef r1cs_gg_ppzksnark<CurveType> proof_system_type;
+    typedef r1cs_gg_ppzksnark_mapped_proving_key<CurveType> mapped_proving_key_type;
+    typedef r1cs_gg_ppzksnark_prover<CurveType> prover_type;
+
+    r1cs_example<typename CurveType::scalar_field_type> example =
+        generate_r1cs_example_with_binary_input<typename CurveType::scalar_field_type>(num_constraints, input_size);
+    typename proof_system_type::keypair_type keypair =
+        nil::crypto3::zk::generate<proof_system_type>(example.constraint_system);
+
+    std::ostringstream os;
+    mapped_proving_key_type::write(keypair.first, os);
+    const std::string blob = os.str();
+
+    // Records are copied out of the buffer, so it does not have to be aligned
+    std::vector<std::uint8_t> data(blob.begin(), blob.end());
+
+    auto mapped_key = mapped_proving_key_type::load(data.data(), data.size());
+    BOOST_REQUIRE(mapped_key);
+    BOOST_CHECK(mapped_key->alpha_g1 == keypair.first.alpha_g1);
+    BOOST_CHECK(mapped_key->beta_g1 == keypair.first.beta_g1);
+    BOOST_CHECK(mapped_key->beta_g2 == keypair.first.beta_g2);
+    BOOST_CHECK(mapped_key->delta_g1 == keypair.first.delta_g1);
+    BOOST_CHECK(mapped_key->delta_g2 == keypair.first.delta_g2);
+    BOOST_CHECK(mapped_key->A_query == keypair.first.A_query);
+    BOOST_CHECK_EQUAL(mapped_key->B_query_domain_size, keypair.first.B_query.domain_size_);
+    BOOST_CHECK(mapped_key->B_query_indices == keypair.first.B_query.indices);
+    BOOST_CHECK(mapped_key->B_query_values == keypair.first.B_query.values);
+    BOOST_CHECK(mapped_key->H_query == keypair.first.H_query);
+    BOOST_CHECK(mapped_key->L_query == keypair.first.L_query);
+
+    typename proof_system_type::proof_type proof =
+        prover_type::process(*mapped_key, example.constraint_system, example.primary_input, example.auxiliary_input);
+    BOOST_CHECK(nil::crypto3::zk::verify<proof_system_type>(keypair.second, example.primary_input, proof));
+
+    // A corrupted payload is only detected with validation, a corrupted header always
+    const std::size_t last_record = data.size() - sizeof(typename mapped_proving_key_type::g1_record_type);
+    data[last_record] ^= 1;
+    BOOST_CHECK(!mapped_proving_key_type::load(data.data(), data.size()));
+    BOOST_CHECK(mapped_proving_key_type::load(data.data(), data.size(), false));
+    data[last_record] ^= 1;
+    data[8] ^= 1;
+    BOOST_CHECK(!mapped_proving_key_type::load(data.data(), data.size(), false));
+    data[8] ^= 1;
+    BOOST_CHECK(!mapped_proving_key_type::load(data.data(), data.size() - 1));
+
+    // A coordinate out of the field is rejected even without validation
+    data.back() = 0xff;
+    BOOST_CHECK(!mapped_proving_key_type::load(data.data(), data.size(), false));
+
+    // B_query indices out of the domain or out of order are rejected even without validation
+    std::vector<std::uint8_t> bad_indices(blob.begin(), blob.end());
+    r1cs_gg_ppzksnark_mapped_proving_key_header header;
+    std::memcpy(&header, bad_indices.data(), sizeof(header));
+    const auto &indices_section = header.sections[r1cs_gg_ppzksnark_mapped_proving_key_header::B_query_indices_section];
+    BOOST_REQUIRE(indices_section.count > 0);
+    const std::uint64_t out_of_domain = header.B_query_domain_size;
+    std::memcpy(bad_indices.data() + indices_section.offset + (indices_section.count - 1) * sizeof(std::uint64_t),
+                &out_of_domain, sizeof(out_of_domain));
+    BOOST_CHECK(!mapped_proving_key_type::load(bad_indices.data(), bad_indices.size(), false));
+
+    const std::string path = "r1cs_gg_ppzksnark_mapped_proving_key.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        mapped_proving_key_type::write(keypair.first, file);
+    }
+    auto opened_key = mapped_proving_key_type::open(path);
+    BOOST_REQUIRE(opened_key);
+    proof =
+        prover_type::process(*opened_key, example.constraint_system, example.primary_input, example.auxiliary_input);
+    BOOST_CHECK(nil::crypto3::zk::verify<proof_system_type>(keypair.second, example.primary_input, proof));
+    std::remove(path.c_str());
+}
+
+template<typename CurveType>
+void run_r1cs_gg_ppzksnark_prepared_proving_key_test(std::size_t num_constraints, std::size_t input_size) {
+    typedef r1cs_gg_ppzksnark<CurveType> proof_system_type;
+    typedef r1cs_gg_ppzksnark_prepared_proving_key<CurveType> prepared_proving_key_type;
+    typedef r1cs_gg_ppzksnark_prover<CurveType> prover_type;
+    typedef typename CurveType::scalar_field_type scalar_field_type;
+    typedef typename CurveType::template g1_type<> g1_type;
+
+    // The tables agree with the naive multiexp for every number of stripes
+    std::vector<typename g1_type::value_type> bases(37);
+    std::vector<typename scalar_field_type::value_type> scalars(bases.size());
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        bases[i] = random_element<g1_type>();
+        scalars[i] = random_element<scalar_field_type>();
+    }
+    scalars[3] = scalar_field_type::value_type::zero();
+    scalars[5] = -scalar_field_type::value_type::one();
+    typename g1_type::value_type expected = g1_type::value_type::zero();
+    for (std::size_t i = 0; i < bases.size() - 1; ++i) {
+        expected = expected + scalars[i] * bases[i];
+    }
+    for (std::size_t stripes : {std::size_t(1), std::size_t(3), std::size_t(1000)}) {
+        nil::crypto3::zk::snark::detail::fixed_base_multiexp_table<g1_type, scalar_field_type> table(
+            bases.begin(), bases.end(), stripes);
+        BOOST_CHECK(table.eval(scalars.begin(), scalars.end() - 1, 4) == expected);
+    }
+
+    r1cs_example<scalar_field_type> example =
+        generate_r1cs_example_with_binary_input<scalar_field_type>(num_constraints, input_size);
+    typename proof_system_type::keypair_type keypair =
+        nil::crypto3::zk::generate<proof_system_type>(example.constraint_system);
+
+    const prepared_proving_key_type prepared_key(keypair.first);
+    BOOST_CHECK_EQUAL(prepared_key.stripes_amount(), prepared_proving_key_type::default_stripes);
+    typename proof_system_type::proof_type proof =
+        prover_type::process(prepared_key, example.primary_input, example.auxiliary_input);
+    BOOST_CHECK(nil::crypto3::zk::verify<proof_system_type>(keypair.second, example.primary_input, proof));
+
+    const prepared_proving_key_type budget_key(keypair.first, 0);
+    BOOST_CHECK_EQUAL(budget_key.stripes_amount(), 1);
+    proof = prover_type::process(budget_key, example.primary_input, example.auxiliary_input);
+    BOOST_CHECK(nil::crypto3::zk::verify<proof_system_type>(keypair.second, example.primary_input, proof));
+
+    const prepared_proving_key_type unbounded_key(keypair.first, std::numeric_limits<std::size_t>::max());
+    BOOST_CHECK_EQUAL(unbounded_key.stripes_amount(), prepared_proving_key_type::g1_table_type::max_stripes);
+    proof = prover_type::process(unbounded_key, example.primary_input, example.auxiliary_input);
+    BOOST_CHECK(nil::crypto3::zk::verify<proof_system_type>(keypair.second, example.primary_input, proof));
+}
+
+template<typename CurveType>
+void run_r1cs_gg_ppzksnark_sparse_multiexp_test(std::size_t size) {
+    typedef typename CurveType::scalar_field_type scalar_field_type;
+    typedef typename CurveType::template g1_type<> g1_type;
+
+    std::vector<typename g1_type::value_type> bases(size);
+    for (auto &base : bases) {
+        base = random_element<g1_type>();
+    }
+
+    // Mostly boolean scalars take the partitioned path, random ones the direct multiexp
+    for (std::size_t general_period : {std::size_t(7), std::size_t(1)}) {
+        std::vector<typename scalar_field_type::value_type> scalars(size);
+        typename g1_type::value_type expected = g1_type::value_type::zero();
+        for (std::size_t i = 0; i < size; ++i) {
+            scalars[i] = i % general_period == 0 ? random_element<scalar_field_type>() :
+                                                   typename scalar_field_type::value_type(i % 2);
+            expected = expected + scalars[i] * bases[i];
+        }
+        BOOST_CHECK(nil::crypto3::zk::snark::detail::sparse_multiexp<policies::multiexp_method_BDLO12>(
+                        bases.begin(), bases.end(), scalars.begin(), scalars.end(), 3) == expected);
+    }
+
+    // Zeros and ones below the threshold are left to the mixed addition multiexp
+    std::vector<typename scalar_field_type::value_type> scalars(size);
+    typename g1_type::value_type expected = g1_type::value_type::zero();
+    for (std::size_t i = 0; i < size; ++i) {
+        scalars[i] = i % 8 == 0 ? typename scalar_field_type::value_type(i % 16 == 0) :
+                                  random_element<scalar_field_type>();
+        expected = expected + scalars[i] * bases[i];
+    }
+    BOOST_CHECK(nil::crypto3::zk::snark::detail::sparse_multiexp<policies::multiexp_method_BDLO12>(
+                    bases.begin(), bases.end(), scalars.begin(), scalars.end(), 3) == expected);
+}
+
 BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_test_suite)
 
 BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_basic_test) {
     run_r1cs_gg_ppzksnark_basic_test<curves::mnt4<298>>(100, 10);
 }
 
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_batch_test) {
+    run_r1cs_gg_ppzksnark_batch_test<curves::mnt4<298>>(100, 10, 4);
+    run_r1cs_gg_ppzksnark_batch_test<curves::mnt4<298>>(100, 10, 5);
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_mapped_proving_key_test) {
+    run_r1cs_gg_ppzksnark_mapped_proving_key_test<curves::mnt4<298>>(100, 10);
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_prepared_proving_key_test) {
+    run_r1cs_gg_ppzksnark_prepared_proving_key_test<curves::mnt4<298>>(100, 10);
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_sparse_multiexp_test) {
+    run_r1cs_gg_ppzksnark_sparse_multiexp_test<curves::mnt4<298>>(100);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
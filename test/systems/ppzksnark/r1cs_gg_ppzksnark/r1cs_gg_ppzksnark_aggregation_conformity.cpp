@@ -44,6 +44,7 @@
 #include <nil/crypto3/algebra/pairing/mnt4.hpp>
 #include <nil/crypto3/algebra/pairing/mnt6.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/zk/commitments/polynomial/kzg_ipp2.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/ipp2/srs.hpp>
@@ -575,6 +576,29 @@ BOOST_AUTO_TEST_CASE(bls381_commitment_test) {
     BOOST_CHECK_EQUAL(wkey_compressed.b, et_w2_compressed);
 }
 
+BOOST_AUTO_TEST_CASE(bls381_multi_pair_test) {
+    using curve_type = curves::bls12_381;
+    using g1_type = typename curve_type::template g1_type<>;
+    using g2_type = typename curve_type::template g2_type<>;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+
+    for (std::size_t n = 1; n <= 5; ++n) {
+        std::vector<typename g1_type::value_type> a;
+        std::vector<typename g2_type::value_type> b;
+        gt_value_type expected = gt_value_type::one();
+        for (std::size_t i = 0; i < n; ++i) {
+            a.emplace_back(random_element<g1_type>());
+            b.emplace_back(random_element<g2_type>());
+            expected = expected * algebra::pair<curve_type>(a.back(), b.back());
+        }
+
+        BOOST_CHECK_EQUAL(
+            final_exponentiation<curve_type>(commitments::detail::multi_pair<curve_type>(a.begin(), a.end(),
+                                                                                         b.begin(), b.end())),
+            final_exponentiation<curve_type>(expected));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(bls381_polynomial_test) {
     constexpr std::size_t n = 8;
     constexpr scalar_field_value_type r_shift(
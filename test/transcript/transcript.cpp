@@ -66,4 +66,50 @@ BOOST_AUTO_TEST_CASE(zk_transcript_manual_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(zk_transcript_sponge_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    using hash_type = hashes::sha2<256>;
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<std::uint8_t> first_blob {0xa, 0xb, 0xc};
+    std::vector<std::uint8_t> second_blob {0xd, 0xe, 0xf};
+    std::vector<std::uint8_t> joint_blob {0xa, 0xb, 0xc, 0xd, 0xe, 0xf};
+
+    zk::transcript::fiat_shamir_heuristic_sponge<hash_type> tr(init_blob);
+    zk::transcript::fiat_shamir_heuristic_sponge<hash_type> joint_tr(init_blob);
+
+    zk::transcript::fiat_shamir_heuristic_sponge<hash_type> same_tr(init_blob);
+    zk::transcript::fiat_shamir_heuristic_sponge<hash_type> shifted_tr(init_blob);
+
+    // absorbs are length-framed, so the same bytes split differently give other challenges
+    tr(first_blob);
+    tr(second_blob);
+    joint_tr(joint_blob);
+    same_tr(first_blob.begin(), first_blob.end());
+    same_tr(second_blob.begin(), second_blob.end());
+    shifted_tr(std::vector<std::uint8_t>(joint_blob.begin(), joint_blob.begin() + 2));
+    shifted_tr(std::vector<std::uint8_t>(joint_blob.begin() + 2, joint_blob.end()));
+
+    auto ch1 = tr.challenge<field_type>();
+    BOOST_CHECK(ch1 != joint_tr.challenge<field_type>());
+    BOOST_CHECK(ch1 != shifted_tr.challenge<field_type>());
+    BOOST_CHECK(ch1 == same_tr.challenge<field_type>());
+
+    // an empty absorb is still part of the transcript
+    zk::transcript::fiat_shamir_heuristic_sponge<hash_type> empty_tr(init_blob);
+    empty_tr(first_blob);
+    empty_tr(std::vector<std::uint8_t>());
+    empty_tr(second_blob);
+    BOOST_CHECK(ch1 != empty_tr.challenge<field_type>());
+
+    // every squeeze moves the state
+    auto ch2 = tr.challenge<field_type>();
+    BOOST_CHECK(ch1 != ch2);
+    BOOST_CHECK(ch2 == same_tr.challenge<field_type>());
+
+    tr.absorb(ch2);
+    same_tr.absorb(ch1);
+    BOOST_CHECK(tr.challenge<field_type>() != same_tr.challenge<field_type>());
+    BOOST_CHECK(tr.int_challenge<std::size_t>() != same_tr.int_challenge<std::size_t>());
+}
+
 BOOST_AUTO_TEST_SUITE_END()